@@ -29,26 +29,19 @@ void initRTC() {
   RTC.setDate(DAY, MONTH, YEAR);         // Set the date
 }
 
-void setup() {
+// write and read 1MB, and print the time
+// streaming = true : multiple block commands (CMD25/CMD18) are used for sequential blocks
+//             false: each block is accessed by single block commands (CMD24/CMD17)
+void benchmark(bool streaming) {
   st_File_v myFile;
   static uint8_t buf[BUF_SIZE];  // write/read buffer, add static to avoid stack overflow
-  uint16_t time, j, remained, size;
+  uint32_t time;
+  uint16_t j, remained, size;
   unsigned long i;
 
   File.init(&myFile);
-
-  Serial.begin(115200);
-
-  initRTC();
-
-  Serial.println("\nInitializing SD card...");
-
-  if (!SD.begin(SDSPI_SS_PIN)) {
-    Serial.println("Initializing failed.");
-    return;
-  } else {
-    Serial.println("\nInitializing successed and card is present.");
-  };
+  SD.setStreaming(streaming);
+  Serial.println(streaming ? "\n[multiple block mode]" : "\n[single block mode]");
 
   // if the file exist, remove it:
   if (SD.exists("test.dat")) {
@@ -75,6 +68,8 @@ void setup() {
   time = millis() - time;
   Serial.print("1MB write speed (ms): ");
   Serial.println_long(time, DEC);
+  Serial.print("write throughput (KB/s): ");
+  Serial.println_long((WRITE_SIZE / 1024) * 1000 / time, DEC);
 
   // open the file. note that only one file can be open at a time,
   // so you have to close this one before opening another.
@@ -100,12 +95,32 @@ void setup() {
     time = millis() - time;
     Serial.print("1MB read speed (ms): ");
     Serial.println_long(time, DEC);
-    Serial.println("Finished.");
+    Serial.print("read throughput (KB/s): ");
+    Serial.println_long((WRITE_SIZE / 1024) * 1000 / time, DEC);
   } else {
     Serial.println("test.dat doesn't exist.");
   }
 }
 
+void setup() {
+  Serial.begin(115200);
+
+  initRTC();
+
+  Serial.println("\nInitializing SD card...");
+
+  if (!SD.begin(SDSPI_SS_PIN)) {
+    Serial.println("Initializing failed.");
+    return;
+  } else {
+    Serial.println("\nInitializing successed and card is present.");
+  };
+
+  benchmark(false);
+  benchmark(true);
+  Serial.println("Finished.");
+}
+
 void loop() {
   // put your main code here, to run repeatedly:
 
@@ -37,18 +37,26 @@ typedef signed char     CHAR;
 
 typedef unsigned char   UINT8;
 typedef unsigned int    UINT16;
-typedef unsigned long   UINT32;
 
 typedef signed char     INT8;
 typedef signed int      INT16;
-typedef signed long     INT32;
 
 typedef unsigned char uint8_t;
 typedef signed char int8_t;
 typedef unsigned short uint16_t;
 typedef signed short int16_t;
+#ifdef __LP64__
+// host build (hardware/lazurite_subghz/host). long is 64bit on host.
+typedef unsigned int    UINT32;
+typedef signed int      INT32;
+typedef unsigned int uint32_t;
+typedef signed int int32_t;
+#else
+typedef unsigned long   UINT32;
+typedef signed long     INT32;
 typedef unsigned long uint32_t;
 typedef signed long int32_t;
+#endif
 typedef uint8_t		boolean;
 typedef uint8_t		byte;
 typedef unsigned int word;
@@ -0,0 +1,44 @@
+/* FILE NAME: math.h
+ *
+ * Copyright (c) 2015  Lapis Semiconductor Co.,Ltd.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef _HOST_MATH_H_
+#define _HOST_MATH_H_
+
+//********************************************************************************
+//   math.h for host build
+//   round() of host collides with the macro in common.h, so only the functions
+//   of the U16 library used by the firmware are declared.
+//********************************************************************************
+extern double fabs(double x);
+extern double floor(double x);
+extern double ceil(double x);
+extern double sqrt(double x);
+extern double pow(double x, double y);
+extern double exp(double x);
+extern double log(double x);
+extern double log10(double x);
+extern double sin(double x);
+extern double cos(double x);
+extern double tan(double x);
+extern double atan(double x);
+extern double atan2(double y, double x);
+
+#endif // _HOST_MATH_H_
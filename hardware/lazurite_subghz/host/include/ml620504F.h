@@ -0,0 +1,326 @@
+/* FILE NAME: ml620504F.h
+ *
+ * Copyright (c) 2015  Lapis Semiconductor Co.,Ltd.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef _ML620504F_H_
+#define _ML620504F_H_
+
+//********************************************************************************
+//   simulated register file for host build
+//   SFR area is emulated by sim_sfr[]. offset of each register is host only and
+//   it is different from ML620Q504. registers which drivers access by pointer
+//   arithmetic keep the order of ML620Q504:
+//     TM0D..TM7D, TM0C..TM7C, TM0CON..TM7CON, TM01D..TM67D, TM01C..TM67C
+//     GPIO port PnD, PnDIR, PnC0, PnC1, PnMD0, PnMD1
+//   flags which firmware polls in a loop (SIM_POLL_BIT) advance simulated time,
+//   so that peripherals of sim/ can complete while firmware is waiting.
+//********************************************************************************
+#define SIM_SFR_SIZE		0x400
+
+typedef struct {
+	unsigned char b0 : 1;
+	unsigned char b1 : 1;
+	unsigned char b2 : 1;
+	unsigned char b3 : 1;
+	unsigned char b4 : 1;
+	unsigned char b5 : 1;
+	unsigned char b6 : 1;
+	unsigned char b7 : 1;
+} SIM_BITS;
+
+extern volatile unsigned char sim_sfr[SIM_SFR_SIZE];
+extern volatile unsigned char *sim_poll(unsigned short ofs);
+
+#define SIM_REG8(ofs)		(*(volatile unsigned char *)&sim_sfr[ofs])
+#define SIM_REG16(ofs)		(*(volatile unsigned short *)&sim_sfr[ofs])
+#define SIM_BIT(ofs,n)		(((volatile SIM_BITS *)&sim_sfr[ofs])->b##n)
+#define SIM_POLL_BIT(ofs,n)	(((volatile SIM_BITS *)sim_poll(ofs))->b##n)
+
+// intrinsic functions of CCU8
+extern void sim_di(void);
+extern void sim_ei(void);
+extern void sim_asm(const char *s);
+#define __DI()				sim_di()
+#define __EI()				sim_ei()
+#define __asm(s)			sim_asm(s)
+
+// block control
+#define BLKCON01			SIM_REG16(0x000)
+#define BLKCON0				SIM_REG8(0x000)
+#define BLKCON1				SIM_REG8(0x001)
+#define BLKCON23			SIM_REG16(0x002)
+#define BLKCON2				SIM_REG8(0x002)
+#define DSIO0				SIM_BIT(0x002,0)
+#define DSIOF0				SIM_BIT(0x002,1)
+#define DI2C0				SIM_BIT(0x002,2)
+#define DI2C1				SIM_BIT(0x002,3)
+#define BLKCON3				SIM_REG8(0x003)
+#define DVLS				SIM_BIT(0x003,0)
+#define BLKCON45			SIM_REG16(0x004)
+#define BLKCON4				SIM_REG8(0x004)
+#define DUA0				SIM_BIT(0x004,0)
+#define DUA1				SIM_BIT(0x004,1)
+#define DUAF0				SIM_BIT(0x004,2)
+#define BLKCON5				SIM_REG8(0x005)
+
+// interrupt enable
+#define IE01				SIM_REG16(0x010)
+#define IE0					SIM_REG8(0x010)
+#define EWDT				SIM_BIT(0x010,0)
+#define IE1					SIM_REG8(0x011)
+#define EEXI0				SIM_BIT(0x011,0)
+#define EEXI5				SIM_BIT(0x011,5)
+#define IE23				SIM_REG16(0x012)
+#define IE2					SIM_REG8(0x012)
+#define ESIO0				SIM_BIT(0x012,0)
+#define ESIOF0				SIM_BIT(0x012,1)
+#define EI2C0				SIM_BIT(0x012,2)
+#define EI2C1				SIM_BIT(0x012,3)
+#define IE3					SIM_REG8(0x013)
+#define EUA0				SIM_BIT(0x013,0)
+#define EUA1				SIM_BIT(0x013,1)
+#define EUAF0				SIM_BIT(0x013,2)
+#define IE45				SIM_REG16(0x014)
+#define IE4					SIM_REG8(0x014)
+#define IE5					SIM_REG8(0x015)
+#define ETM0				SIM_BIT(0x015,0)
+#define ETM1				SIM_BIT(0x015,1)
+#define ETM6				SIM_BIT(0x015,6)
+#define ETM7				SIM_BIT(0x015,7)
+#define IE67				SIM_REG16(0x016)
+#define IE6					SIM_REG8(0x016)
+#define IE7					SIM_REG8(0x017)
+#define ELTBC0				SIM_BIT(0x017,0)
+
+// interrupt request
+#define IRQ01				SIM_REG16(0x018)
+#define IRQ0				SIM_REG8(0x018)
+#define QWDT				SIM_POLL_BIT(0x018,0)
+#define IRQ1				SIM_REG8(0x019)
+#define QEXI0				SIM_POLL_BIT(0x019,0)
+#define QEXI5				SIM_POLL_BIT(0x019,5)
+#define IRQ23				SIM_REG16(0x01A)
+#define IRQ2				SIM_REG8(0x01A)
+#define QSIO0				SIM_POLL_BIT(0x01A,0)
+#define QSIOF0				SIM_POLL_BIT(0x01A,1)
+#define QI2C0				SIM_POLL_BIT(0x01A,2)
+#define QI2C1				SIM_POLL_BIT(0x01A,3)
+#define IRQ3				SIM_REG8(0x01B)
+#define QUA0				SIM_BIT(0x01B,0)
+#define QUA1				SIM_BIT(0x01B,1)
+#define QUAF0				SIM_BIT(0x01B,2)
+#define IRQ45				SIM_REG16(0x01C)
+#define IRQ4				SIM_REG8(0x01C)
+#define IRQ5				SIM_REG8(0x01D)
+#define QTM0				SIM_POLL_BIT(0x01D,0)
+#define QTM1				SIM_POLL_BIT(0x01D,1)
+#define QTM6				SIM_POLL_BIT(0x01D,6)
+#define QTM7				SIM_POLL_BIT(0x01D,7)
+#define IRQ67				SIM_REG16(0x01E)
+#define IRQ6				SIM_REG8(0x01E)
+#define IRQ7				(*sim_poll(0x01F))
+#define QLTBC0				SIM_POLL_BIT(0x01F,0)
+#define ILE					SIM_REG8(0x020)
+
+// timer 0-7
+#define TM0D				SIM_REG8(0x040)
+#define TM01D				SIM_REG16(0x040)
+#define TM23D				SIM_REG16(0x042)
+#define TM45D				SIM_REG16(0x044)
+#define TM67D				SIM_REG16(0x046)
+#define TM0C				SIM_REG8(0x048)
+#define TM01C				SIM_REG16(0x048)
+#define TM23C				SIM_REG16(0x04A)
+#define TM45C				SIM_REG16(0x04C)
+#define TM67C				SIM_REG16(0x04E)
+#define TM0CON				SIM_REG8(0x050)
+#define TMSTR0				(*sim_poll(0x058))
+#define TMSTP0				(*sim_poll(0x059))
+#define TMSTAT0				SIM_REG8(0x05A)
+
+// low speed time base counter
+#define LTBR				(*sim_poll(0x060))
+#define LTBADJ				SIM_REG16(0x062)
+#define LTBINT				SIM_REG16(0x064)
+
+// watch dog timer
+#define WDTCON				SIM_REG8(0x068)
+#define WDTMOD				SIM_REG8(0x069)
+#define HLTEN				SIM_BIT(0x069,7)
+
+// standby control
+#define SBYCON				SIM_REG8(0x06A)
+#define HLT					SIM_BIT(0x06A,0)
+#define STP					SIM_BIT(0x06A,1)
+#define HLTH				SIM_BIT(0x06A,2)
+#define DHLT				SIM_BIT(0x06A,3)
+#define STPACP				SIM_REG8(0x06B)
+
+// clock
+#define FCON01				SIM_REG16(0x070)
+#define FCON0				SIM_REG8(0x070)
+#define FCON1				SIM_REG8(0x071)
+#define SYSCLK				SIM_BIT(0x071,0)
+#define ENOSC				SIM_BIT(0x071,1)
+#define LOSCON				SIM_BIT(0x071,3)
+#define FCON2				SIM_REG8(0x072)
+#define FSTAT				SIM_REG8(0x073)
+#define HOSST				SIM_BIT(0x073,1)
+#define LOSST				SIM_BIT(0x073,2)
+
+// voltage level supervisor
+#define VLSCON				SIM_REG16(0x078)
+#define VLSCONL				SIM_REG8(0x078)
+#define ENVLS				SIM_BIT(0x079,0)
+#define VLSMOD				SIM_REG16(0x07A)
+#define VLSSTAT				SIM_REG8(0x07C)
+#define VLSF				SIM_BIT(0x07C,0)
+#define VLSRF				SIM_BIT(0x07C,1)
+
+// I2C0/1. bit6 of I2CnCON0 is used by sim_i2c to detect command.
+#define I2C0RD				SIM_REG8(0x080)
+#define I2C0SA				SIM_REG8(0x081)
+#define I2C0TD				SIM_REG8(0x082)
+#define I2C0CON0			SIM_REG8(0x083)
+#define I2C0MOD				SIM_REG16(0x084)
+#define I2C0MODL			SIM_REG8(0x084)
+#define I2C0STAT			SIM_REG8(0x086)
+#define I20ER				SIM_BIT(0x086,0)
+#define I20ACR				SIM_BIT(0x086,1)
+#define I2C1RD				SIM_REG8(0x088)
+#define I2C1SA				SIM_REG8(0x089)
+#define I2C1TD				SIM_REG8(0x08A)
+#define I2C1CON0			SIM_REG8(0x08B)
+#define I2C1MOD				SIM_REG16(0x08C)
+#define I2C1MODL			SIM_REG8(0x08C)
+#define I2C1STAT			SIM_REG8(0x08E)
+#define I21ER				SIM_BIT(0x08E,0)
+#define I21ACR				SIM_BIT(0x08E,1)
+
+// SIOF0 (SPI)
+#define SF0CTRL				SIM_REG16(0x0A0)
+#define SF0CTRLL			SIM_REG8(0x0A0)
+#define SF0SPE				SIM_BIT(0x0A0,0)
+#define SF0MST				SIM_BIT(0x0A0,1)
+#define SF0CTRLH			SIM_REG8(0x0A1)
+#define SF0SIZE				SIM_BIT(0x0A1,0)
+#define SF0BRR				SIM_REG16(0x0A2)
+#define SF0DWR				SIM_REG16(0x0A4)
+#define SF0DWRL				SIM_REG8(0x0A4)
+#define SF0DRR				SIM_REG16(0x0A6)
+#define SF0DRRL				SIM_REG8(0x0A6)
+#define SF0INT				SIM_REG8(0x0A8)
+#define SF0SPIE				SIM_BIT(0x0A8,0)
+#define SF0SPIF				SIM_POLL_BIT(0x0A8,1)
+#define SF0SPIFC			SIM_BIT(0x0A8,2)
+#define SF0FICL				SIM_BIT(0x0A8,3)
+
+// GPIO
+#define SIM_PORT(n)			(0x100 + (n) * 8)
+#define P0D					SIM_REG8(0x100)
+#define P0DIR				SIM_REG8(0x101)
+#define P0CON				SIM_REG16(0x102)
+#define P0MOD				SIM_REG16(0x104)
+#define P1D					SIM_REG8(0x108)
+#define P1DIR				SIM_REG8(0x109)
+#define P1CON				SIM_REG16(0x10A)
+#define P1MOD				SIM_REG16(0x10C)
+#define P2D					SIM_REG8(0x110)
+#define P2DIR				SIM_REG8(0x111)
+#define P2CON				SIM_REG16(0x112)
+#define P2MOD				SIM_REG16(0x114)
+#define P3D					SIM_REG8(0x118)
+#define P3DIR				SIM_REG8(0x119)
+#define P3CON				SIM_REG16(0x11A)
+#define P3MOD				SIM_REG16(0x11C)
+#define P4D					SIM_REG8(0x120)
+#define P4DIR				SIM_REG8(0x121)
+#define P4CON				SIM_REG16(0x122)
+#define P4MOD				SIM_REG16(0x124)
+#define P5D					SIM_REG8(0x128)
+#define P5DIR				SIM_REG8(0x129)
+#define P5CON				SIM_REG16(0x12A)
+#define P5MOD				SIM_REG16(0x12C)
+
+#define SIM_PIN(p,b,r)		SIM_BIT(SIM_PORT(p) + (r), b)
+#define P34D				SIM_POLL_BIT(0x118,4)
+#define P34DIR				SIM_PIN(3,4,1)
+#define P34C0				SIM_PIN(3,4,2)
+#define P34C1				SIM_PIN(3,4,3)
+#define P34MD0				SIM_PIN(3,4,4)
+#define P34MD1				SIM_PIN(3,4,5)
+#define P35D				SIM_PIN(3,5,0)
+#define P35DIR				SIM_PIN(3,5,1)
+#define P35C0				SIM_PIN(3,5,2)
+#define P35C1				SIM_PIN(3,5,3)
+#define P35MD0				SIM_PIN(3,5,4)
+#define P35MD1				SIM_PIN(3,5,5)
+#define P36DIR				SIM_PIN(3,6,1)
+#define P36C0				SIM_PIN(3,6,2)
+#define P36C1				SIM_PIN(3,6,3)
+#define P36MD0				SIM_PIN(3,6,4)
+#define P36MD1				SIM_PIN(3,6,5)
+#define P40D				SIM_POLL_BIT(0x120,0)
+#define P40DIR				SIM_PIN(4,0,1)
+#define P40C0				SIM_PIN(4,0,2)
+#define P40C1				SIM_PIN(4,0,3)
+#define P40MD0				SIM_PIN(4,0,4)
+#define P40MD1				SIM_PIN(4,0,5)
+#define P41D				SIM_PIN(4,1,0)
+#define P41DIR				SIM_PIN(4,1,1)
+#define P41C0				SIM_PIN(4,1,2)
+#define P41C1				SIM_PIN(4,1,3)
+#define P41MD0				SIM_PIN(4,1,4)
+#define P41MD1				SIM_PIN(4,1,5)
+#define P44DIR				SIM_PIN(4,4,1)
+#define P44C0				SIM_PIN(4,4,2)
+#define P44C1				SIM_PIN(4,4,3)
+#define P44MD0				SIM_PIN(4,4,4)
+#define P44MD1				SIM_PIN(4,4,5)
+#define P45DIR				SIM_PIN(4,5,1)
+#define P45C0				SIM_PIN(4,5,2)
+#define P45C1				SIM_PIN(4,5,3)
+#define P45MD0				SIM_PIN(4,5,4)
+#define P45MD1				SIM_PIN(4,5,5)
+
+// UART0/1
+#define UA0BUF				SIM_REG8(0x200)
+#define UA0MOD0				SIM_REG8(0x202)
+#define UA0MOD1				SIM_REG8(0x203)
+#define UA0BRT				SIM_REG16(0x204)
+#define UA0CON				SIM_REG8(0x206)
+#define U0EN				SIM_BIT(0x206,0)
+#define UA1BUF				SIM_REG8(0x208)
+
+// UARTF0
+#define UAF0BUF				SIM_REG16(0x220)
+#define UAF0IER				SIM_REG8(0x222)
+#define UAF0IIR				SIM_REG16(0x224)
+#define UF0IRQ				SIM_BIT(0x224,0)
+#define UAF0FCR				SIM_REG8(0x226)
+#define UF0RFR				SIM_BIT(0x226,1)
+#define UF0TFR				SIM_BIT(0x226,2)
+#define UAF0LCR				SIM_REG8(0x227)
+#define UF0DLAB				SIM_BIT(0x227,7)
+#define UAF0LSR				SIM_REG16(0x228)
+#define UAF0MOD				SIM_REG16(0x22A)
+#define UAF0CAJ				SIM_REG8(0x22C)
+
+#endif // _ML620504F_H_
@@ -0,0 +1,47 @@
+/* FILE NAME: rdwr_reg.h
+ *
+ * Copyright (c) 2015  Lapis Semiconductor Co.,Ltd.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef _RDWR_REG_H_
+#define _RDWR_REG_H_
+
+//********************************************************************************
+//   register access for host build
+//   byte and word access go through sim_reg_read/sim_reg_write so that a test can
+//   observe or answer the access of a register. bit access is direct.
+//********************************************************************************
+extern unsigned short sim_reg_read(volatile void *adr, unsigned char size);
+extern void sim_reg_write(volatile void *adr, unsigned char size, unsigned short data);
+
+#define read_reg8(a)        ((unsigned char)sim_reg_read(&(a),1))
+#define read_reg16(a)       ((unsigned short)sim_reg_read(&(a),2))
+#define write_reg8(a,d)     sim_reg_write(&(a),1,(unsigned char)(d))
+#define write_reg16(a,d)    sim_reg_write(&(a),2,(unsigned short)(d))
+#define set_reg8(a,m)       ((a)|=(unsigned char)(m))
+#define set_reg16(a,m)      ((a)|=(unsigned short)(m))
+#define clear_reg8(a,m)     ((a)&=~(unsigned char)(m))
+#define clear_reg16(a,m)    ((a)&=~(unsigned short)(m))
+
+#define set_bit(n)          ((n) = 1)
+#define clear_bit(n)        ((n) = 0)
+#define get_bit(n)          (n)
+#define write_bit(n,d)      ((n) = (d))
+
+#endif /* _RDWR_REG_H_ */
@@ -0,0 +1,43 @@
+/* FILE NAME: stdlib.h
+ *
+ * Copyright (c) 2015  Lapis Semiconductor Co.,Ltd.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef _HOST_STDLIB_H_
+#define _HOST_STDLIB_H_
+
+//********************************************************************************
+//   stdlib.h for host build
+//   stdlib.h of host conflicts with common.h (int32_t, random), so only the
+//   functions of the U16 library used by the firmware are declared.
+//********************************************************************************
+#include <stddef.h>
+
+extern int abs(int x);
+extern long labs(long x);
+extern int atoi(const char *s);
+extern long atol(const char *s);
+extern int rand(void);
+extern void srand(unsigned int seed);
+extern void *malloc(size_t size);
+extern void *calloc(size_t n, size_t size);
+extern void free(void *p);
+extern void exit(int status);
+
+#endif // _HOST_STDLIB_H_
@@ -0,0 +1,157 @@
+/* FILE NAME: sim.h
+ *
+ * Copyright (c) 2015  Lapis Semiconductor Co.,Ltd.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef _SIM_H_
+#define _SIM_H_
+
+//********************************************************************************
+//   host simulation of ML620Q504
+//   sim_reg   : register file (sim_sfr), hooks of register access and WDT
+//   sim_irq   : interrupt controller (IEn/IRQn, MIE), handler table and DI/EI
+//   sim_clock : time base, timer 0-7, LTBC, standby modes and scheduled events
+//   sim_gpio  : pin level of drv_pinMode/drv_digitalWrite/drv_digitalRead
+//   sim_i2c   : I2C0/1 master with slave device models
+//   sim_spi   : SIOF0 master with FIFO and a slave device model
+//   sim_sd    : SD card in SPI mode on SIOF0 with an image in memory
+//
+//   time advances only when firmware accesses a register by read_reg/write_reg,
+//   polls a flag defined by SIM_POLL_BIT, executes __asm("nop") or enters standby.
+//   cost of an access is SIM_ACCESS_CYCLES and nop is 1 cycle of HSCLK(16MHz).
+//   code which does not touch the hardware takes no time, so that time of a call
+//   is the time of hardware (bus transfer, wait of timer and so on), not of CPU.
+//********************************************************************************
+
+// 1 unit of simulated time = 1/512 usec, so that both HSCLK(16MHz) and LSCLK(32768Hz)
+// are exact.
+typedef unsigned long long SIM_TIME;
+#define SIM_US(us)			((SIM_TIME)(us) * 512)
+#define SIM_MS(ms)			((SIM_TIME)(ms) * 512000)
+#define SIM_CYCLE			32			// HSCLK 16MHz
+#define SIM_LSCLK			15625		// LSCLK 32768Hz
+#define SIM_ACCESS_CYCLES	2
+
+// reset all registers, hooks, handlers, peripherals and clock.
+// MIE is 1 as after init(), so that tests of drivers can run without init().
+extern void sim_reset(void);
+// sim_reset() and init() of lazurite_system.c. timer 0/1 runs for millis().
+extern void sim_boot(void);
+
+// statistics of simulation. sim_stat_clear() is called by sim_reset().
+typedef struct {
+	unsigned long	access;			// register access by read_reg/write_reg and poll
+	unsigned long	nop;			// __asm("nop")
+	unsigned long	irq;			// interrupt handlers executed
+	unsigned long	halt[4];		// standby entries. HALT, HALT-H, DEEP-HALT, STOP
+	SIM_TIME		halt_time[4];	// time in standby
+	SIM_TIME		isr_time_max;	// longest time spent in an interrupt handler
+} SIM_STAT;
+extern SIM_STAT sim_stat;
+extern void sim_stat_clear(void);
+
+// register access hook. rd/wr is called when read_reg or write_reg accesses the register.
+// NULL is available for either of them.
+// return = 0: ok, -1: hook table is full
+extern void sim_reg_reset(void);
+extern int sim_reg_hook(volatile void *adr, unsigned short (*rd)(void), void (*wr)(unsigned short data));
+
+// interrupt controller. sim_irq_raise sets the request flag (IRQn), and handler set by
+// irq_sethandler is called when the interrupt is enabled (IEn) and MIE = 1.
+// interrupt raised in handler is called after the handler returns.
+extern void sim_irq_reset(void);
+extern void sim_irq_raise(unsigned char intNo);
+extern void sim_irq_dispatch(void);
+extern unsigned char sim_irq_in_isr(void);
+extern unsigned char sim_irq_pending(void);		// 1 = enabled request is pending (releases standby)
+
+// time base
+extern SIM_TIME sim_time;
+extern void sim_clock_reset(void);
+extern unsigned char sim_clock_busy(void);			// 1 = in peripheral model or event
+extern void sim_step(unsigned short cycles);		// CPU runs cycles of HSCLK
+extern void sim_run(SIM_TIME t);					// CPU runs without register access for t
+extern void sim_clock_advance(unsigned long us);	// same as sim_run(SIM_US(us))
+extern void sim_standby(unsigned char mode);		// called by sim_asm when SBYCON is set
+// event which is called at time t in simulation, such as interrupt of external device.
+// return = 0: ok, -1: event table is full
+extern int sim_at(SIM_TIME t, void (*func)(void));
+
+// GPIO. pin is the number of drv_pinMode(), 0-35 (digital_pin_to_port[])
+extern void sim_gpio_reset(void);
+extern unsigned char sim_gpio_level(unsigned char pin);
+extern void sim_gpio_input(unsigned char pin, unsigned char level);
+extern void sim_gpio_hook(void (*func)(unsigned char pin, unsigned char level));
+
+// I2C slave device. callbacks are called when the master accesses the address.
+// start : address phase. return 1 = ACK, 0 = NACK
+// write : data from master. return 1 = ACK, 0 = NACK
+// read  : data to master. ack = 0 when master sends NACK (last byte)
+// stop  : stop condition. NULL is available
+typedef struct {
+	unsigned char address;
+	unsigned char (*start)(unsigned char read);
+	unsigned char (*write)(unsigned char data);
+	unsigned char (*read)(unsigned char ack);
+	void (*stop)(void);
+} SIM_I2C_DEV;
+typedef struct {
+	unsigned long	bytes;			// address and data bytes on bus
+	unsigned long	start;			// start and restart conditions
+	unsigned long	stop;			// stop conditions
+} SIM_I2C_STAT;
+extern void sim_i2c_reset(void);
+extern int sim_i2c_attach(unsigned char ch, const SIM_I2C_DEV *dev);
+extern void sim_i2c_stuck(unsigned char ch, unsigned char clocks);	// slave holds SDA for clocks of SCL
+extern void sim_i2c_stat(unsigned char ch, SIM_I2C_STAT *stat);
+extern unsigned char sim_i2c_busy(unsigned char ch);
+extern void sim_i2c_poll(void);
+extern SIM_TIME sim_i2c_next(void);
+extern void sim_i2c_run(SIM_TIME t);
+extern void sim_i2c_shift(SIM_TIME t);
+
+// SPI slave device. exchange is called for each byte on MOSI and returns byte on MISO.
+// 16bit frame is exchanged as 2 bytes in the bit order of SF0CTRL.
+typedef struct {
+	unsigned long	bytes;			// bytes on bus
+	unsigned long	bursts;			// writes to SF0DWR while FIFO is idle
+} SIM_SPI_STAT;
+extern void sim_spi_reset(void);
+extern void sim_spi_attach(unsigned char (*exchange)(unsigned char mosi));
+extern void sim_spi_stat(SIM_SPI_STAT *stat);
+extern void sim_spi_poll(void);
+extern SIM_TIME sim_spi_next(void);
+extern void sim_spi_run(SIM_TIME t);
+extern void sim_spi_shift(SIM_TIME t);
+
+// SD card. image has blocks x 512 bytes, and sdhc = 0 uses byte address (SD V2).
+// chip select is the pin of digitalWrite(). sim_spi_attach and sim_gpio_hook are used.
+typedef struct {
+	unsigned long	cmd;			// commands
+	unsigned long	block_read;		// blocks sent to the host by CMD17 and CMD18
+	unsigned long	block_write;	// blocks written by CMD24 and CMD25
+	unsigned long	multi_read;		// CMD18
+	unsigned long	multi_write;	// CMD25
+	unsigned long	error;			// commands rejected and sequence errors
+} SIM_SD_STAT;
+extern void sim_sd_insert(unsigned char cs_pin, unsigned char *image, unsigned long blocks, unsigned char sdhc);
+extern void sim_sd_stat(SIM_SD_STAT *stat);
+extern void sim_sd_stat_clear(void);
+
+#endif // _SIM_H_
@@ -0,0 +1,295 @@
+/* FILE NAME: sim_clock.c
+ *
+ * Copyright (c) 2015  Lapis Semiconductor Co.,Ltd.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "common.h"
+#include "mcu.h"
+#include "driver_irq.h"
+#include "sim.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SIM_EVENT_MAX		16
+#define SIM_STANDBY_MAX		SIM_MS(600000)		// standby without wakeup is a deadlock
+
+// registers accessed by the model. macros of ml620504F.h are not used for registers
+// which are polled, because polling advances time.
+#define SIM_TMSTR0			SIM_REG8(0x058)
+#define SIM_TMSTP0			SIM_REG8(0x059)
+#define SIM_IRQ5			SIM_REG8(0x01D)
+#define SIM_IRQ7			SIM_REG8(0x01F)
+#define SIM_LTBR			SIM_REG8(0x060)
+
+SIM_TIME sim_time = 0;
+static SIM_TIME sim_lsclk_next;
+static unsigned char sim_hsclk_on;			// 0 in HALT-H, DEEP-HALT and STOP mode
+static unsigned char sim_lsclk_on;			// 0 in STOP mode
+static unsigned char sim_busy;				// time is advancing
+static unsigned char sim_tm_run;			// running timers
+static unsigned char sim_tm_pre[8];			// prescaler of timers
+static unsigned short sim_ltb_pre;			// LSCLK count of LTBR
+
+static struct {
+	SIM_TIME t;
+	void (*func)(void);
+} sim_event[SIM_EVENT_MAX];
+static unsigned char sim_event_num;
+
+void sim_clock_reset(void)
+{
+	sim_time = 0;
+	sim_lsclk_next = SIM_LSCLK;
+	sim_hsclk_on = 1;
+	sim_lsclk_on = 1;
+	sim_busy = 0;
+	sim_tm_run = 0;
+	memset(sim_tm_pre, 0, sizeof(sim_tm_pre));
+	sim_ltb_pre = 0;
+	sim_event_num = 0;
+}
+
+unsigned char sim_clock_busy(void)
+{
+	return sim_busy;
+}
+
+int sim_at(SIM_TIME t, void (*func)(void))
+{
+	if(sim_event_num >= SIM_EVENT_MAX) return -1;
+	sim_event[sim_event_num].t = t;
+	sim_event[sim_event_num].func = func;
+	sim_event_num++;
+	return 0;
+}
+
+// start and stop of timers. bits written to TMSTR0/TMSTP0 are read as 0.
+static void sim_tm_ctrl(void)
+{
+	sim_tm_run &= (unsigned char)~SIM_TMSTP0;
+	sim_tm_run |= SIM_TMSTR0;
+	SIM_TMSTP0 = 0;
+	SIM_TMSTR0 = 0;
+}
+
+// timer 0-7 counts LSCLK divided by TnDIV (bit 3-5 of TMnCON).
+// even and odd timer are combined when bit 6 of TMnCON of even timer is set.
+// counter is cleared when it matches TMnD, and timer stops in one shot mode (bit 7).
+static void sim_tm_count(unsigned char ch)
+{
+	unsigned char con = SIM_REG8(0x050 + ch);
+	unsigned char wide = (con & 0x40) && ((ch & 1) == 0);
+	unsigned char irq = wide ? ch + 1 : ch;
+	unsigned short count, data;
+
+	if(++sim_tm_pre[ch] < (1 << ((con >> 3) & 7))) return;
+	sim_tm_pre[ch] = 0;
+	if(wide) {
+		count = SIM_REG16(0x048 + ch);
+		data = SIM_REG16(0x040 + ch);
+	} else {
+		count = SIM_REG8(0x048 + ch);
+		data = SIM_REG8(0x040 + ch);
+	}
+	if(count == data) {
+		count = 0;
+		SIM_IRQ5 |= (unsigned char)(1 << irq);
+		if(con & 0x80) sim_tm_run &= (unsigned char)~(1 << ch);
+	} else {
+		count++;
+	}
+	if(wide) SIM_REG16(0x048 + ch) = count;
+	else SIM_REG8(0x048 + ch) = (unsigned char)count;
+}
+
+static void sim_lsclk_edge(void)
+{
+	unsigned char ch;
+
+	sim_tm_ctrl();
+	for(ch = 0; ch < 8; ch++)
+	{
+		if((sim_tm_run & (1 << ch)) == 0) continue;
+		if((ch & 1) && (SIM_REG8(0x050 + ch - 1) & 0x40)) continue;	// upper of 16bit timer
+		sim_tm_count(ch);
+	}
+	// LTBR counts 128Hz, and LTBC0INT is requested at each count (default of LTBINT)
+	if(++sim_ltb_pre >= 256) {
+		sim_ltb_pre = 0;
+		SIM_LTBR++;
+		SIM_IRQ7 |= 0x01;
+	}
+}
+
+static SIM_TIME sim_next(void)
+{
+	SIM_TIME n = ~(SIM_TIME)0;
+	SIM_TIME t;
+	unsigned char i;
+
+	if(sim_lsclk_on) n = sim_lsclk_next;
+	if(sim_hsclk_on) {
+		t = sim_i2c_next();
+		if(t < n) n = t;
+		t = sim_spi_next();
+		if(t < n) n = t;
+	}
+	for(i = 0; i < sim_event_num; i++)
+	{
+		if(sim_event[i].t < n) n = sim_event[i].t;
+	}
+	return n;
+}
+
+static void sim_event_run(SIM_TIME t)
+{
+	unsigned char i = 0;
+	void (*func)(void);
+
+	while(i < sim_event_num)
+	{
+		if(sim_event[i].t > t) {
+			i++;
+			continue;
+		}
+		func = sim_event[i].func;
+		sim_event[i] = sim_event[--sim_event_num];
+		func();
+	}
+}
+
+// advance time to t. peripherals run, and interrupt requests are set.
+static void sim_advance(SIM_TIME t)
+{
+	SIM_TIME n;
+
+	for(;;)
+	{
+		n = sim_next();
+		if(n > t) break;
+		if(n > sim_time) sim_time = n;
+		if(sim_lsclk_on && (n == sim_lsclk_next)) {
+			sim_lsclk_edge();
+			sim_lsclk_next += SIM_LSCLK;
+		}
+		if(sim_hsclk_on) {
+			sim_i2c_run(n);
+			sim_spi_run(n);
+		}
+		sim_event_run(n);
+	}
+	if(t > sim_time) sim_time = t;
+}
+
+static void sim_poll_all(void)
+{
+	sim_tm_ctrl();
+	sim_i2c_poll();
+	sim_spi_poll();
+}
+
+void sim_step(unsigned short cycles)
+{
+	if(sim_busy) return;				// access in model or event
+	sim_busy = 1;
+	sim_poll_all();
+	sim_advance(sim_time + (SIM_TIME)cycles * SIM_CYCLE);
+	sim_poll_all();
+	sim_busy = 0;
+	sim_irq_dispatch();
+}
+
+void sim_run(SIM_TIME t)
+{
+	SIM_TIME end = sim_time + t;
+	SIM_TIME n;
+
+	while(sim_time < end)
+	{
+		sim_busy = 1;
+		sim_poll_all();
+		n = sim_next();
+		sim_advance((n < end) ? n : end);
+		sim_poll_all();
+		sim_busy = 0;
+		sim_irq_dispatch();
+	}
+}
+
+void sim_clock_advance(unsigned long us)
+{
+	sim_run(SIM_US(us));
+}
+
+// HALT, HALT-H, DEEP-HALT and STOP mode. released by interrupt request which is
+// enabled by IEn, even if MIE = 0.
+// HSCLK stops except HALT mode, so that I2C and SPI do not progress.
+// LSCLK also stops in STOP mode, and only events of sim_at() can release it.
+void sim_standby(unsigned char mode)
+{
+	SIM_TIME start = sim_time;
+	SIM_TIME n;
+
+	sim_stat.halt[mode]++;
+	sim_busy = 1;
+	sim_poll_all();
+	if(mode != 0) sim_hsclk_on = 0;
+	if(mode == 3) sim_lsclk_on = 0;
+	while(!sim_irq_pending())
+	{
+		n = sim_next();
+		if(n > start + SIM_STANDBY_MAX) {
+			fprintf(stderr, "sim: no wakeup from standby mode %d at %llu us\n", mode, (unsigned long long)(start / 512));
+			exit(3);
+		}
+		sim_advance(n);
+	}
+	if(!sim_hsclk_on) {
+		sim_i2c_shift(sim_time - start);
+		sim_spi_shift(sim_time - start);
+	}
+	if(!sim_lsclk_on) {
+		sim_lsclk_next += sim_time - start;
+	}
+	sim_hsclk_on = 1;
+	sim_lsclk_on = 1;
+	sim_stat.halt_time[mode] += sim_time - start;
+	sim_busy = 0;
+	sim_irq_dispatch();
+}
+
+// __asm() of CCU8. only "nop" is used in firmware. standby mode starts at the
+// instruction after setting SBYCON.
+void sim_asm(const char *s)
+{
+	unsigned char sby = SBYCON;
+
+	(void)s;
+	sim_stat.nop++;
+	if(sby == 0) {
+		sim_step(1);
+		return;
+	}
+	SBYCON = 0;
+	if(sby & 0x02) sim_standby(3);			// STP
+	else if(sby & 0x08) sim_standby(2);		// DHLT
+	else if(sby & 0x04) sim_standby(1);		// HLTH
+	else sim_standby(0);					// HLT
+}
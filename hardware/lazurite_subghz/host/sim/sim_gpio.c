@@ -0,0 +1,126 @@
+/* FILE NAME: sim_gpio.c
+ *
+ * Copyright (c) 2015  Lapis Semiconductor Co.,Ltd.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+#include "common.h"
+#include "lazurite.h"
+#include "driver_gpio.h"
+#include "sim.h"
+
+// number of pins of drv_pinMode() (ML620504F_MAX_PIN_NO + 1)
+#define SIM_GPIO_PIN_NUM	36
+
+static unsigned char sim_gpio_out[SIM_GPIO_PIN_NUM];	// level set by drv_digitalWrite
+static unsigned char sim_gpio_in[SIM_GPIO_PIN_NUM];	// level given by sim_gpio_input
+static unsigned char sim_gpio_dir[SIM_GPIO_PIN_NUM];	// 1 = input
+static void (*sim_gpio_func)(unsigned char pin, unsigned char level);
+
+// tables of driver_gpio.c for libraries which write PnD directly, such as TFT.
+// addresses of sim_sfr are stored in int as on the board, so that executables are
+// linked with -no-pie (see Makefile).
+int ml620504f_pin_to_port[SIM_GPIO_PIN_NUM];
+const unsigned char ml620504f_pin_to_bit[SIM_GPIO_PIN_NUM] =
+{
+	0x01, 0x02, 0x04, 0x08, 0x10, 0x20,							// P00-P05
+	0x01, 0x02,													// P10-P11
+	0x01, 0x02, 0x04, 0x08,										// P20-P23
+	0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80,				// P30-P37
+	0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80,				// P40-P47
+	0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80,				// P50-P57
+};
+
+// pin -> PnD. P00-P05, P10-P11, P20-P23, P30-P37, P40-P47, P50-P57
+static volatile unsigned char* sim_gpio_port(unsigned char pin, unsigned char *bit)
+{
+	static const unsigned char first[7] = { 0, 6, 8, 12, 20, 28, SIM_GPIO_PIN_NUM };
+	unsigned char n;
+	for(n = 0; pin >= first[n + 1]; n++) {}
+	*bit = (unsigned char)(1 << (pin - first[n]));
+	return &sim_sfr[SIM_PORT(n)];
+}
+
+void sim_gpio_reset(void)
+{
+	unsigned char i, bit;
+	for(i = 0; i < SIM_GPIO_PIN_NUM; i++)
+	{
+		ml620504f_pin_to_port[i] = (int)(long)sim_gpio_port(i, &bit);
+		sim_gpio_out[i] = 0;
+		sim_gpio_in[i] = 1;						// pulled up
+		sim_gpio_dir[i] = 1;
+	}
+	sim_gpio_func = NULL;
+}
+
+unsigned char sim_gpio_level(unsigned char pin)
+{
+	if(pin >= SIM_GPIO_PIN_NUM) return 0;
+	return sim_gpio_dir[pin] ? sim_gpio_in[pin] : sim_gpio_out[pin];
+}
+
+void sim_gpio_input(unsigned char pin, unsigned char level)
+{
+	if(pin >= SIM_GPIO_PIN_NUM) return;
+	sim_gpio_in[pin] = level ? 1 : 0;
+}
+
+// func is called when output level of a pin is changed, such as chip select of SPI
+void sim_gpio_hook(void (*func)(unsigned char pin, unsigned char level))
+{
+	sim_gpio_func = func;
+}
+
+//********************************************************************************
+//   API of driver_gpio.c
+//********************************************************************************
+volatile void drv_pinMode(unsigned char pin, unsigned char mode)
+{
+	volatile unsigned char *port;
+	unsigned char bit;
+
+	if(pin >= SIM_GPIO_PIN_NUM) return;
+	port = sim_gpio_port(pin, &bit);
+	sim_gpio_dir[pin] = (mode != OUTPUT);
+	if(mode == OUTPUT) port[1] &= (unsigned char)~bit;
+	else port[1] |= bit;
+	sim_step(SIM_ACCESS_CYCLES);
+}
+
+int drv_digitalRead(unsigned char pin)
+{
+	if(pin >= SIM_GPIO_PIN_NUM) return(LOW);
+	sim_step(SIM_ACCESS_CYCLES);
+	return sim_gpio_level(pin) ? HIGH : LOW;
+}
+
+void drv_digitalWrite(unsigned char pin, unsigned char val)
+{
+	volatile unsigned char *port;
+	unsigned char bit;
+	unsigned char level = (val == LOW) ? 0 : 1;
+	unsigned char changed;
+
+	if(pin >= SIM_GPIO_PIN_NUM) return;
+	port = sim_gpio_port(pin, &bit);
+	if(level) *port |= bit;
+	else *port &= (unsigned char)~bit;
+	changed = (sim_gpio_out[pin] != level);
+	sim_gpio_out[pin] = level;
+	if(changed && !sim_gpio_dir[pin] && sim_gpio_func) sim_gpio_func(pin, level);
+	sim_step(SIM_ACCESS_CYCLES);
+}
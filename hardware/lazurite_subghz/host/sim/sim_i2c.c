@@ -0,0 +1,230 @@
+/* FILE NAME: sim_i2c.c
+ *
+ * Copyright (c) 2015  Lapis Semiconductor Co.,Ltd.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+#include "common.h"
+#include "mcu.h"
+#include "driver_irq.h"
+#include "sim.h"
+#include <string.h>
+
+#define SIM_I2C_DEV_MAX		4
+
+// registers of I2Cn (n = ch). see ml620504F.h
+#define SIM_I2C_RD(ch)		SIM_REG8(0x080 + (ch) * 8)
+#define SIM_I2C_SA(ch)		SIM_REG8(0x081 + (ch) * 8)
+#define SIM_I2C_TD(ch)		SIM_REG8(0x082 + (ch) * 8)
+#define SIM_I2C_CON(ch)		SIM_REG8(0x083 + (ch) * 8)
+#define SIM_I2C_MODL(ch)	SIM_REG8(0x084 + (ch) * 8)
+#define SIM_I2C_STAT(ch)	SIM_REG8(0x086 + (ch) * 8)
+#define SIM_I2C_ER			0x01
+#define SIM_I2C_ACR			0x02
+// I2CnCON0. command is detected by bit 6 which is cleared by writing of firmware.
+#define SIM_I2C_CON_ST		0x01				// bus is held by master
+#define SIM_I2C_CON_SP		0x02				// stop condition
+#define SIM_I2C_CON_RS		0x04				// restart condition
+#define SIM_I2C_CON_ACT		0x80				// NACK to the received byte
+#define SIM_I2C_CON_SIM		0x40
+
+// SDA and SCL of general port for bus recovery. SDA = P40/P34, SCL = P41/P35
+static const unsigned short sim_i2c_port[2] = { SIM_PORT(4), SIM_PORT(3) };
+static const unsigned char sim_i2c_sda[2] = { 0x01, 0x10 };
+static const unsigned char sim_i2c_scl[2] = { 0x02, 0x20 };
+
+enum { SIM_I2C_IDLE, SIM_I2C_ADDR, SIM_I2C_WRITE, SIM_I2C_READ, SIM_I2C_STOP };
+
+static struct {
+	const SIM_I2C_DEV *dev[SIM_I2C_DEV_MAX];
+	unsigned char dev_num;
+	const SIM_I2C_DEV *cur;					// addressed device
+	unsigned char held;						// after start condition
+	unsigned char cmd;						// command in progress
+	unsigned char ack;						// ack of master for read
+	SIM_TIME done;							// end of command
+	unsigned char stuck;					// slave holds SDA for clocks of SCL
+	unsigned char scl;						// SCL of general port
+	SIM_I2C_STAT stat;
+} sim_i2c[2];
+
+void sim_i2c_reset(void)
+{
+	unsigned char ch;
+	memset(sim_i2c, 0, sizeof(sim_i2c));
+	for(ch = 0; ch < 2; ch++)
+	{
+		SIM_I2C_CON(ch) = SIM_I2C_CON_SIM;
+		sim_i2c[ch].scl = 1;
+	}
+}
+
+int sim_i2c_attach(unsigned char ch, const SIM_I2C_DEV *dev)
+{
+	if((ch >= 2) || (sim_i2c[ch].dev_num >= SIM_I2C_DEV_MAX)) return -1;
+	sim_i2c[ch].dev[sim_i2c[ch].dev_num++] = dev;
+	return 0;
+}
+
+void sim_i2c_stuck(unsigned char ch, unsigned char clocks)
+{
+	if(ch < 2) sim_i2c[ch].stuck = clocks;
+}
+
+void sim_i2c_stat(unsigned char ch, SIM_I2C_STAT *stat)
+{
+	if(ch < 2) *stat = sim_i2c[ch].stat;
+}
+
+unsigned char sim_i2c_busy(unsigned char ch)
+{
+	return (ch < 2) ? (sim_i2c[ch].cmd != SIM_I2C_IDLE) : 0;
+}
+
+// time of bits on bus. I2CnMOD bit 1 = fast mode(400kHz)
+static SIM_TIME sim_i2c_bits(unsigned char ch, unsigned char bits)
+{
+	return (SIM_I2C_MODL(ch) & 0x02) ? (SIM_TIME)bits * SIM_US(5) / 2 : (SIM_TIME)bits * SIM_US(10);
+}
+
+static void sim_i2c_command(unsigned char ch, unsigned char con)
+{
+	unsigned char bits = 9;
+
+	if(con & SIM_I2C_CON_SP) {
+		sim_i2c[ch].cmd = SIM_I2C_STOP;
+		bits = 1;
+	} else if((con & SIM_I2C_CON_RS) || !sim_i2c[ch].held) {
+		sim_i2c[ch].cmd = SIM_I2C_ADDR;
+		bits = 10;
+	} else if(SIM_I2C_SA(ch) & 0x01) {
+		sim_i2c[ch].cmd = SIM_I2C_READ;
+		sim_i2c[ch].ack = (con & SIM_I2C_CON_ACT) ? 0 : 1;
+	} else {
+		sim_i2c[ch].cmd = SIM_I2C_WRITE;
+	}
+	sim_i2c[ch].done = (sim_i2c[ch].stuck != 0) ? ~(SIM_TIME)0 : sim_time + sim_i2c_bits(ch, bits);
+	SIM_I2C_CON(ch) = SIM_I2C_CON_SIM | SIM_I2C_CON_ST;
+}
+
+// general port is used by bus recovery. SCL pulses release SDA of stuck slave.
+static void sim_i2c_port_poll(unsigned char ch)
+{
+	volatile unsigned char *port = &sim_sfr[sim_i2c_port[ch]];
+	unsigned char scl = (port[1] & sim_i2c_scl[ch]) ? 1 : 0;		// DIR = 1: released
+
+	if(port[4] & sim_i2c_sda[ch]) return;							// SDA is I2C function
+	if(!sim_i2c[ch].scl && scl && sim_i2c[ch].stuck) sim_i2c[ch].stuck--;
+	sim_i2c[ch].scl = scl;
+	if(sim_i2c[ch].stuck || !(port[1] & sim_i2c_sda[ch])) port[0] &= (unsigned char)~sim_i2c_sda[ch];
+	else port[0] |= sim_i2c_sda[ch];
+}
+
+void sim_i2c_poll(void)
+{
+	unsigned char ch, con;
+
+	for(ch = 0; ch < 2; ch++)
+	{
+		sim_i2c_port_poll(ch);
+		if((SIM_I2C_MODL(ch) & 0x01) == 0) {				// I2C is stopped
+			sim_i2c[ch].cmd = SIM_I2C_IDLE;
+			sim_i2c[ch].held = 0;
+			sim_i2c[ch].cur = NULL;
+			SIM_I2C_CON(ch) = SIM_I2C_CON_SIM;
+			continue;
+		}
+		con = SIM_I2C_CON(ch);
+		if(con & SIM_I2C_CON_SIM) continue;					// not written by firmware
+		sim_i2c_command(ch, con);
+	}
+}
+
+SIM_TIME sim_i2c_next(void)
+{
+	SIM_TIME n = ~(SIM_TIME)0;
+	unsigned char ch;
+	for(ch = 0; ch < 2; ch++)
+	{
+		if((sim_i2c[ch].cmd != SIM_I2C_IDLE) && (sim_i2c[ch].done < n)) n = sim_i2c[ch].done;
+	}
+	return n;
+}
+
+static const SIM_I2C_DEV* sim_i2c_find(unsigned char ch, unsigned char address)
+{
+	unsigned char i;
+	for(i = 0; i < sim_i2c[ch].dev_num; i++)
+	{
+		if(sim_i2c[ch].dev[i]->address == address) return sim_i2c[ch].dev[i];
+	}
+	return NULL;
+}
+
+static void sim_i2c_complete(unsigned char ch)
+{
+	const SIM_I2C_DEV *dev = sim_i2c[ch].cur;
+	unsigned char nack = 0;
+
+	switch(sim_i2c[ch].cmd)
+	{
+	case SIM_I2C_ADDR:
+		sim_i2c[ch].stat.start++;
+		sim_i2c[ch].stat.bytes++;
+		sim_i2c[ch].held = 1;
+		dev = sim_i2c_find(ch, SIM_I2C_SA(ch) >> 1);
+		sim_i2c[ch].cur = dev;
+		nack = !((dev != NULL) && dev->start(SIM_I2C_SA(ch) & 0x01));
+		break;
+	case SIM_I2C_WRITE:
+		sim_i2c[ch].stat.bytes++;
+		nack = !((dev != NULL) && dev->write(SIM_I2C_TD(ch)));
+		break;
+	case SIM_I2C_READ:
+		sim_i2c[ch].stat.bytes++;
+		SIM_I2C_RD(ch) = (dev != NULL) ? dev->read(sim_i2c[ch].ack) : 0xFF;
+		break;
+	default:
+		sim_i2c[ch].stat.stop++;
+		if((dev != NULL) && (dev->stop != NULL)) dev->stop();
+		sim_i2c[ch].cur = NULL;
+		sim_i2c[ch].held = 0;
+		break;
+	}
+	if(nack) SIM_I2C_STAT(ch) |= SIM_I2C_ACR;
+	else SIM_I2C_STAT(ch) &= (unsigned char)~SIM_I2C_ACR;
+	sim_i2c[ch].cmd = SIM_I2C_IDLE;
+	SIM_I2C_CON(ch) = SIM_I2C_CON_SIM | (sim_i2c[ch].held ? SIM_I2C_CON_ST : 0);
+	SIM_REG8(0x01A) |= (unsigned char)(0x04 << ch);		// QI2Cn
+}
+
+void sim_i2c_run(SIM_TIME t)
+{
+	unsigned char ch;
+	for(ch = 0; ch < 2; ch++)
+	{
+		if((sim_i2c[ch].cmd != SIM_I2C_IDLE) && (sim_i2c[ch].done <= t)) sim_i2c_complete(ch);
+	}
+}
+
+void sim_i2c_shift(SIM_TIME t)
+{
+	unsigned char ch;
+	for(ch = 0; ch < 2; ch++)
+	{
+		if((sim_i2c[ch].cmd != SIM_I2C_IDLE) && (sim_i2c[ch].done != ~(SIM_TIME)0)) sim_i2c[ch].done += t;
+	}
+}
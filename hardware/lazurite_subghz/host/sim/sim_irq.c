@@ -0,0 +1,179 @@
+/* FILE NAME: sim_irq.c
+ *
+ * Copyright (c) 2015  Lapis Semiconductor Co.,Ltd.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "common.h"
+#include "mcu.h"
+#include "driver_irq.h"
+#include "sim.h"
+
+// IRQ_SIZE of driver_irq.c
+#define SIM_IRQ_SIZE		38
+
+// first interrupt number of IE0-IE7/IRQ0-IRQ7, bit 0 of each register
+static const unsigned char sim_irq_base[9] = {
+	IRQ_NO_WDTINT, IRQ_NO_EXI0INT, IRQ_NO_SIO0INT, IRQ_NO_UA0INT,
+	IRQ_NO_LOSCINT, IRQ_NO_TM0INT, IRQ_NO_FTM0INT, IRQ_NO_LTBC0INT, SIM_IRQ_SIZE
+};
+
+static void (*sim_irq_hdr[SIM_IRQ_SIZE])(void);
+static unsigned char sim_irq_isr = 0;
+static unsigned char sim_irq_mie = 1;
+unsigned short di_flag = 0;
+
+static volatile unsigned char* sim_irq_reg(unsigned short ofs, unsigned char intNo, unsigned char *mask)
+{
+	unsigned char n;
+	for(n = 0; intNo >= sim_irq_base[n + 1]; n++) {}
+	*mask = (unsigned char)(1 << (intNo - sim_irq_base[n]));
+	return &sim_sfr[ofs + n];
+}
+
+// number of interrupt which is requested and enabled. SIM_IRQ_SIZE = none
+static unsigned char sim_irq_find(void)
+{
+	unsigned char intNo, mask;
+	for(intNo = 0; intNo < SIM_IRQ_SIZE; intNo++)
+	{
+		if((*sim_irq_reg(0x018, intNo, &mask) & mask) && (*sim_irq_reg(0x010, intNo, &mask) & mask)) break;
+	}
+	return intNo;
+}
+
+unsigned char sim_irq_pending(void)
+{
+	return (sim_irq_find() < SIM_IRQ_SIZE);
+}
+
+// interrupt is accepted between instructions when MIE = 1. handler is not nested
+// because MIE is cleared during handler same as ML620Q504.
+void sim_irq_dispatch(void)
+{
+	unsigned char intNo, mask;
+	SIM_TIME start;
+
+	if(sim_clock_busy()) return;					// dispatched after time is advanced
+	while(sim_irq_mie && !sim_irq_isr)
+	{
+		intNo = sim_irq_find();
+		if(intNo >= SIM_IRQ_SIZE) break;
+		*sim_irq_reg(0x018, intNo, &mask) &= (unsigned char)~mask;
+		sim_stat.irq++;
+		if(sim_irq_hdr[intNo] == NULL) continue;
+		start = sim_time;
+		sim_irq_isr = 1;
+		sim_irq_mie = 0;
+		if(intNo != IRQ_NO_WDTINT) di_flag |= DI_INTERRUPT;
+		sim_irq_hdr[intNo]();
+		if(intNo != IRQ_NO_WDTINT) di_flag &= ~DI_INTERRUPT;
+		sim_irq_mie = 1;
+		sim_irq_isr = 0;
+		if(sim_time - start > sim_stat.isr_time_max) sim_stat.isr_time_max = sim_time - start;
+	}
+}
+
+void sim_irq_reset(void)
+{
+	unsigned char i;
+	for(i = 0; i < SIM_IRQ_SIZE; i++)
+	{
+		sim_irq_hdr[i] = NULL;
+	}
+	sim_irq_isr = 0;
+	sim_irq_mie = 1;
+	di_flag = 0;
+}
+
+void sim_irq_raise(unsigned char intNo)
+{
+	unsigned char mask;
+	if(intNo >= SIM_IRQ_SIZE) return;
+	*sim_irq_reg(0x018, intNo, &mask) |= mask;
+	sim_irq_dispatch();
+}
+
+unsigned char sim_irq_in_isr(void)
+{
+	return sim_irq_isr;
+}
+
+void sim_di(void)
+{
+	sim_irq_mie = 0;
+}
+
+void sim_ei(void)
+{
+	sim_irq_mie = 1;
+	sim_irq_dispatch();
+}
+
+//********************************************************************************
+//   API of driver_irq.c
+//********************************************************************************
+void irq_init(void)
+{
+	unsigned char i;
+	write_reg16(IE01, 0x00);
+	write_reg16(IE23, 0x00);
+	write_reg16(IE45, 0x00);
+	write_reg16(IE67, 0x00);
+	write_reg16(IRQ01, 0x00);
+	write_reg16(IRQ23, 0x00);
+	write_reg16(IRQ45, 0x00);
+	write_reg16(IRQ67, 0x00);
+	ILE = 0;
+	for(i = 0; i < SIM_IRQ_SIZE; i++)
+	{
+		sim_irq_hdr[i] = NULL;
+	}
+}
+
+int irq_sethandler( unsigned char intNo, void (*func)( void ) )
+{
+	if( intNo >= (unsigned char)SIM_IRQ_SIZE ) {
+		return ( IRQ_R_ERR_INTNO );
+	}
+	sim_irq_hdr[intNo] = func;
+	return ( IRQ_R_OK );
+}
+
+void rst_interrupts(void)
+{
+	di_flag = 0;
+	__EI();
+}
+
+unsigned char getMIE(void)
+{
+	return sim_irq_mie;
+}
+
+void enb_interrupts(unsigned short irq_ch)
+{
+	di_flag &= ~irq_ch;
+	if(di_flag == 0) __EI();
+}
+
+void dis_interrupts(unsigned short irq_ch)
+{
+	__DI();
+	di_flag |= irq_ch;
+}
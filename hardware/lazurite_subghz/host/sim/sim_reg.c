@@ -0,0 +1,134 @@
+/* FILE NAME: sim_reg.c
+ *
+ * Copyright (c) 2015  Lapis Semiconductor Co.,Ltd.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "sim.h"
+#include "ml620504F.h"
+#include "rdwr_reg.h"
+#include <string.h>
+
+#define SIM_REG_HOOK_MAX	16
+
+typedef struct {
+	volatile void *adr;
+	unsigned short (*rd)(void);
+	void (*wr)(unsigned short data);
+} SIM_REG_HOOK;
+
+volatile unsigned char sim_sfr[SIM_SFR_SIZE];
+SIM_STAT sim_stat;
+static SIM_REG_HOOK sim_reg_hooks[SIM_REG_HOOK_MAX];
+static unsigned char sim_reg_hook_num = 0;
+
+extern void init(void);
+
+static SIM_REG_HOOK* sim_reg_find(volatile void *adr)
+{
+	unsigned char i;
+	for(i = 0; i < sim_reg_hook_num; i++)
+	{
+		if(sim_reg_hooks[i].adr == adr) return &sim_reg_hooks[i];
+	}
+	return NULL;
+}
+
+// WDTCON: WDP is toggled by writing 0x5A, and counter is cleared by 0xA5 after it.
+static void sim_wdtcon_write(unsigned short data)
+{
+	static unsigned char wdp = 0;
+	if(data == 0x5A) wdp ^= 1;
+	else if(data == 0xA5) wdp = 0;
+	WDTCON = wdp;
+}
+
+void sim_reg_reset(void)
+{
+	memset((void *)sim_sfr, 0, sizeof(sim_sfr));
+	sim_reg_hook_num = 0;
+	VLSRF = 1;										// result of VLS is valid
+	sim_reg_hook(&WDTCON, NULL, sim_wdtcon_write);
+}
+
+int sim_reg_hook(volatile void *adr, unsigned short (*rd)(void), void (*wr)(unsigned short data))
+{
+	SIM_REG_HOOK *hook = sim_reg_find(adr);
+	if(hook == NULL)
+	{
+		if(sim_reg_hook_num >= SIM_REG_HOOK_MAX) return -1;
+		hook = &sim_reg_hooks[sim_reg_hook_num++];
+		hook->adr = adr;
+	}
+	hook->rd = rd;
+	hook->wr = wr;
+	return 0;
+}
+
+unsigned short sim_reg_read(volatile void *adr, unsigned char size)
+{
+	SIM_REG_HOOK *hook = sim_reg_find(adr);
+	unsigned short data;
+
+	if((hook != NULL) && (hook->rd != NULL)) data = hook->rd();
+	else if(size == 1) data = *(volatile unsigned char *)adr;
+	else data = *(volatile unsigned short *)adr;
+	sim_stat.access++;
+	sim_step(SIM_ACCESS_CYCLES);
+	return data;
+}
+
+void sim_reg_write(volatile void *adr, unsigned char size, unsigned short data)
+{
+	SIM_REG_HOOK *hook = sim_reg_find(adr);
+	if(size == 1) *(volatile unsigned char *)adr = (unsigned char)data;
+	else *(volatile unsigned short *)adr = data;
+	if((hook != NULL) && (hook->wr != NULL)) hook->wr(data);
+	sim_stat.access++;
+	sim_step(SIM_ACCESS_CYCLES);
+}
+
+// register which is polled by firmware. time advances before the access.
+volatile unsigned char *sim_poll(unsigned short ofs)
+{
+	sim_stat.access++;
+	sim_step(SIM_ACCESS_CYCLES);
+	return &sim_sfr[ofs];
+}
+
+void sim_stat_clear(void)
+{
+	memset(&sim_stat, 0, sizeof(sim_stat));
+}
+
+void sim_reset(void)
+{
+	sim_reg_reset();
+	sim_irq_reset();
+	sim_clock_reset();
+	sim_gpio_reset();
+	sim_i2c_reset();
+	sim_spi_reset();
+	sim_stat_clear();
+}
+
+void sim_boot(void)
+{
+	sim_reset();
+	init();
+}
@@ -0,0 +1,295 @@
+/* FILE NAME: sim_sd.c
+ *
+ * Copyright (c) 2015  Lapis Semiconductor Co.,Ltd.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "common.h"
+#include "pin_assignment.h"
+#include "sim.h"
+#include <string.h>
+
+// SD card in SPI mode on SIOF0. data is read from and written to the image in memory.
+// responses follow the timing of the card loosely: 1 byte of NCR before R1, 1 byte
+// of NAC before the start token, and 2 bytes of busy after write and CMD12.
+// CMD18 keeps sending blocks while the card is selected, so that the byte after
+// CMD12 (stuff byte) is the data of the stream as on a real card.
+
+#define SIM_SD_OUT			1024
+#define SIM_SD_NAC			1
+#define SIM_SD_BUSY			2
+
+#define SIM_SD_RX_NONE		0
+#define SIM_SD_RX_TOKEN		1			// waiting data token of CMD24/CMD25
+#define SIM_SD_RX_DATA		2
+
+static struct {
+	unsigned char *image;
+	unsigned long blocks;
+	unsigned char sdhc;
+	unsigned char cs_pin;				// pin of drv_digitalWrite()
+	unsigned char cs;					// 1 = selected
+	unsigned char cmd[6];
+	unsigned char cmd_len;
+	unsigned char out[SIM_SD_OUT];		// response queue
+	unsigned short out_rd;
+	unsigned short out_wr;
+	unsigned char idle;
+	unsigned char app;					// CMD55 is received
+	unsigned char acmd41;
+	unsigned char rx;
+	unsigned char multi;				// CMD25
+	unsigned short rx_len;
+	unsigned char rx_buf[514];
+	unsigned long rx_block;
+	unsigned char stream;				// CMD18
+	unsigned long stream_block;
+	unsigned short stream_pos;
+	SIM_SD_STAT stat;
+} sim_sd;
+
+static void sim_sd_put(unsigned char data)
+{
+	if(sim_sd.out_wr < SIM_SD_OUT) sim_sd.out[sim_sd.out_wr++] = data;
+}
+
+static void sim_sd_busy(void)
+{
+	unsigned char i;
+	for(i = 0; i < SIM_SD_BUSY; i++) sim_sd_put(0x00);
+}
+
+// next byte of CMD18. NAC, start token, data and CRC of each block
+static unsigned char sim_sd_stream_byte(void)
+{
+	unsigned short pos = sim_sd.stream_pos++;
+
+	if(pos < SIM_SD_NAC) return 0xFF;
+	if(pos == SIM_SD_NAC) return 0xFE;
+	pos -= SIM_SD_NAC + 1;
+	if(pos < 512) {
+		return (sim_sd.stream_block < sim_sd.blocks) ? sim_sd.image[sim_sd.stream_block * 512 + pos] : 0x00;
+	}
+	if(pos == 513) {
+		sim_sd.stream_pos = 0;
+		sim_sd.stream_block++;
+		sim_sd.stat.block_read++;
+	}
+	return 0x00;						// CRC
+}
+
+static unsigned long sim_sd_block(unsigned long arg)
+{
+	return sim_sd.sdhc ? arg : arg >> 9;
+}
+
+static void sim_sd_command(void)
+{
+	unsigned char c = sim_sd.cmd[0] & 0x3F;
+	unsigned long arg = ((unsigned long)sim_sd.cmd[1] << 24) | ((unsigned long)sim_sd.cmd[2] << 16) |
+		((unsigned long)sim_sd.cmd[3] << 8) | sim_sd.cmd[4];
+	unsigned char app = sim_sd.app;
+	unsigned long block = sim_sd_block(arg);
+	unsigned short i;
+
+	sim_sd.app = 0;
+	sim_sd.stat.cmd++;
+	if(c == 12) {
+		if(sim_sd.stream) {
+			sim_sd_put(sim_sd_stream_byte());		// stuff byte
+			sim_sd.stream = 0;
+		} else {
+			sim_sd_put(0xFF);
+		}
+		sim_sd_put(0x00);
+		sim_sd_busy();
+		return;
+	}
+	sim_sd_put(0xFF);							// NCR
+	if(sim_sd.stream) {
+		sim_sd.stat.error++;						// CMD18 must be stopped by CMD12
+		sim_sd.stream = 0;
+	}
+	if(app) c |= 0x80;
+	switch(c)
+	{
+	case 0:
+		sim_sd.idle = 1;
+		sim_sd.acmd41 = 0;
+		sim_sd.rx = SIM_SD_RX_NONE;
+		sim_sd_put(0x01);
+		break;
+	case 8:										// R7
+		sim_sd_put(sim_sd.idle);
+		sim_sd_put(0x00);
+		sim_sd_put(0x00);
+		sim_sd_put((unsigned char)((arg >> 8) & 0x0F));
+		sim_sd_put((unsigned char)arg);
+		break;
+	case 55:
+		sim_sd.app = 1;
+		sim_sd_put(sim_sd.idle);
+		break;
+	case 0x80 | 41:								// ready at the second ACMD41
+		if(++sim_sd.acmd41 >= 2) sim_sd.idle = 0;
+		sim_sd_put(sim_sd.idle);
+		break;
+	case 0x80 | 23:
+		sim_sd_put(sim_sd.idle);
+		break;
+	case 58:									// R3
+		sim_sd_put(sim_sd.idle);
+		sim_sd_put(sim_sd.sdhc ? 0xC0 : 0x80);
+		sim_sd_put(0xFF);
+		sim_sd_put(0x80);
+		sim_sd_put(0x00);
+		break;
+	case 13:									// R2
+		sim_sd_put(sim_sd.idle);
+		sim_sd_put(0x00);
+		break;
+	case 17:
+		if(sim_sd.idle || (block >= sim_sd.blocks)) {
+			sim_sd_put(0x40 | sim_sd.idle);		// parameter error
+			sim_sd.stat.error++;
+			break;
+		}
+		sim_sd_put(0x00);
+		for(i = 0; i < SIM_SD_NAC; i++) sim_sd_put(0xFF);
+		sim_sd_put(0xFE);
+		for(i = 0; i < 512; i++) sim_sd_put(sim_sd.image[block * 512 + i]);
+		sim_sd_put(0x00);
+		sim_sd_put(0x00);
+		sim_sd.stat.block_read++;
+		break;
+	case 18:
+		if(sim_sd.idle || (block >= sim_sd.blocks)) {
+			sim_sd_put(0x40 | sim_sd.idle);
+			sim_sd.stat.error++;
+			break;
+		}
+		sim_sd_put(0x00);
+		sim_sd.stream = 1;
+		sim_sd.stream_block = block;
+		sim_sd.stream_pos = 0;
+		sim_sd.stat.multi_read++;
+		break;
+	case 24:
+	case 25:
+		if(sim_sd.idle || (block >= sim_sd.blocks)) {
+			sim_sd_put(0x40 | sim_sd.idle);
+			sim_sd.stat.error++;
+			break;
+		}
+		sim_sd_put(0x00);
+		sim_sd.rx = SIM_SD_RX_TOKEN;
+		sim_sd.multi = (c == 25);
+		sim_sd.rx_block = block;
+		if(sim_sd.multi) sim_sd.stat.multi_write++;
+		break;
+	default:
+		sim_sd_put(0x04 | sim_sd.idle);			// illegal command
+		break;
+	}
+}
+
+// data token and block of CMD24/CMD25
+static unsigned char sim_sd_receive(unsigned char mosi)
+{
+	if(sim_sd.rx == SIM_SD_RX_TOKEN) {
+		if(mosi == (sim_sd.multi ? 0xFC : 0xFE)) {
+			sim_sd.rx = SIM_SD_RX_DATA;
+			sim_sd.rx_len = 0;
+			return 1;
+		}
+		if(sim_sd.multi && (mosi == 0xFD)) {		// stop transmission
+			sim_sd.rx = SIM_SD_RX_NONE;
+			sim_sd.multi = 0;
+			sim_sd_busy();
+			return 1;
+		}
+		return (mosi == 0xFF);						// other byte is a command
+	}
+	sim_sd.rx_buf[sim_sd.rx_len++] = mosi;
+	if(sim_sd.rx_len < sizeof(sim_sd.rx_buf)) return 1;
+	if(sim_sd.rx_block < sim_sd.blocks) {
+		memcpy(&sim_sd.image[sim_sd.rx_block * 512], sim_sd.rx_buf, 512);
+		sim_sd.stat.block_write++;
+		sim_sd_put(0x05);							// data accepted
+	} else {
+		sim_sd_put(0x0D);							// write error
+		sim_sd.stat.error++;
+	}
+	sim_sd_busy();
+	sim_sd.rx_block++;
+	sim_sd.rx = sim_sd.multi ? SIM_SD_RX_TOKEN : SIM_SD_RX_NONE;
+	return 1;
+}
+
+static unsigned char sim_sd_exchange(unsigned char mosi)
+{
+	unsigned char miso;
+
+	if(!sim_sd.cs) return 0xFF;
+	if(sim_sd.out_rd < sim_sd.out_wr) {
+		miso = sim_sd.out[sim_sd.out_rd++];
+		if(sim_sd.out_rd == sim_sd.out_wr) sim_sd.out_rd = sim_sd.out_wr = 0;
+	} else if(sim_sd.stream) {
+		miso = sim_sd_stream_byte();
+	} else {
+		miso = 0xFF;
+	}
+	if((sim_sd.rx != SIM_SD_RX_NONE) && (sim_sd.cmd_len == 0) && sim_sd_receive(mosi)) return miso;
+	if((sim_sd.cmd_len == 0) && ((mosi & 0xC0) != 0x40)) return miso;
+	sim_sd.cmd[sim_sd.cmd_len++] = mosi;
+	if(sim_sd.cmd_len == sizeof(sim_sd.cmd)) {
+		sim_sd.cmd_len = 0;
+		sim_sd.rx = SIM_SD_RX_NONE;
+		sim_sd_command();
+	}
+	return miso;
+}
+
+static void sim_sd_cs(unsigned char pin, unsigned char level)
+{
+	if(pin != sim_sd.cs_pin) return;
+	sim_sd.cs = !level;
+	if(level) sim_sd.cmd_len = 0;
+}
+
+void sim_sd_insert(unsigned char cs_pin, unsigned char *image, unsigned long blocks, unsigned char sdhc)
+{
+	memset(&sim_sd, 0, sizeof(sim_sd));
+	sim_sd.image = image;
+	sim_sd.blocks = blocks;
+	sim_sd.sdhc = sdhc;
+	sim_sd.cs_pin = digital_pin_to_port[cs_pin];
+	sim_sd.idle = 1;
+	sim_spi_attach(sim_sd_exchange);
+	sim_gpio_hook(sim_sd_cs);
+}
+
+void sim_sd_stat(SIM_SD_STAT *stat)
+{
+	*stat = sim_sd.stat;
+}
+
+void sim_sd_stat_clear(void)
+{
+	memset(&sim_sd.stat, 0, sizeof(sim_sd.stat));
+}
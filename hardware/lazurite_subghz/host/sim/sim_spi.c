@@ -0,0 +1,161 @@
+/* FILE NAME: sim_spi.c
+ *
+ * Copyright (c) 2015  Lapis Semiconductor Co.,Ltd.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+#include "common.h"
+#include "mcu.h"
+#include "rdwr_reg.h"
+#include "sim.h"
+#include <string.h>
+
+#define SIM_SPI_FIFO		4
+
+// registers of SIOF0. see ml620504F.h
+#define SIM_SF0CTRLL		SIM_REG8(0x0A0)
+#define SIM_SF0CTRLH		SIM_REG8(0x0A1)
+#define SIM_SF0BRR			SIM_REG16(0x0A2)
+#define SIM_SF0DRR			SIM_REG16(0x0A6)
+#define SIM_SF0INT			SIM_REG8(0x0A8)
+#define SIM_SF0SPE			0x01				// SF0CTRLL
+#define SIM_SF0MSB			0x10				// SPI_MSBFIRST
+#define SIM_SF0SIZE			0x01				// SF0CTRLH
+#define SIM_SF0SPIE			0x01				// SF0INT
+#define SIM_SF0SPIF			0x02
+#define SIM_SF0SPIFC		0x04
+#define SIM_SF0FICL			0x08
+
+static struct {
+	unsigned short tx[SIM_SPI_FIFO];
+	unsigned char tx_num;
+	unsigned short rx[SIM_SPI_FIFO];
+	unsigned char rx_num;
+	unsigned char busy;						// frame is on bus
+	SIM_TIME done;							// end of frame
+	unsigned char (*exchange)(unsigned char mosi);
+	SIM_SPI_STAT stat;
+} sim_spi;
+
+static unsigned char sim_spi_byte(unsigned char mosi)
+{
+	sim_spi.stat.bytes++;
+	return (sim_spi.exchange != NULL) ? sim_spi.exchange(mosi) : 0xFF;
+}
+
+static void sim_spi_frame_start(SIM_TIME start)
+{
+	unsigned char bits = (SIM_SF0CTRLH & SIM_SF0SIZE) ? 16 : 8;
+	unsigned short brr = SIM_SF0BRR ? SIM_SF0BRR : 1;
+
+	sim_spi.busy = 1;
+	sim_spi.done = start + (SIM_TIME)bits * 2 * brr * SIM_CYCLE;	// SCK = HSCLK / (2 * SF0BRR)
+}
+
+static void sim_spi_dwr_write(unsigned short data)
+{
+	if((SIM_SF0CTRLL & SIM_SF0SPE) == 0) return;
+	if(!sim_spi.busy && (sim_spi.tx_num == 0)) {
+		sim_spi.stat.bursts++;
+		sim_spi.rx_num = 0;
+	}
+	SIM_SF0INT &= (unsigned char)~SIM_SF0SPIF;
+	if(sim_spi.tx_num < SIM_SPI_FIFO) sim_spi.tx[sim_spi.tx_num++] = data;
+	if(!sim_spi.busy) sim_spi_frame_start(sim_time);
+}
+
+static unsigned short sim_spi_drr_read(void)
+{
+	unsigned short data = SIM_SF0DRR;
+	if(sim_spi.rx_num == 0) return data;
+	sim_spi.rx_num--;
+	memmove(sim_spi.rx, sim_spi.rx + 1, sim_spi.rx_num * sizeof(sim_spi.rx[0]));
+	SIM_SF0DRR = sim_spi.rx[0];
+	return data;
+}
+
+void sim_spi_reset(void)
+{
+	memset(&sim_spi, 0, sizeof(sim_spi));
+	sim_reg_hook(&SF0DWR, NULL, sim_spi_dwr_write);
+	sim_reg_hook(&SF0DRR, sim_spi_drr_read, NULL);
+}
+
+void sim_spi_attach(unsigned char (*exchange)(unsigned char mosi))
+{
+	sim_spi.exchange = exchange;
+}
+
+void sim_spi_stat(SIM_SPI_STAT *stat)
+{
+	*stat = sim_spi.stat;
+}
+
+void sim_spi_poll(void)
+{
+	if(SIM_SF0INT & SIM_SF0SPIFC) {
+		SIM_SF0INT &= (unsigned char)~(SIM_SF0SPIF | SIM_SF0SPIFC);
+	}
+	if(SIM_SF0INT & SIM_SF0FICL) {
+		sim_spi.tx_num = 0;
+		sim_spi.rx_num = 0;
+	}
+	if((SIM_SF0CTRLL & SIM_SF0SPE) == 0) {
+		sim_spi.busy = 0;
+		sim_spi.tx_num = 0;
+	}
+}
+
+SIM_TIME sim_spi_next(void)
+{
+	return sim_spi.busy ? sim_spi.done : ~(SIM_TIME)0;
+}
+
+// frame of 16bit is exchanged as 2 bytes in the bit order
+void sim_spi_run(SIM_TIME t)
+{
+	unsigned short tx, rx;
+
+	while(sim_spi.busy && (sim_spi.done <= t))
+	{
+		tx = sim_spi.tx[0];
+		sim_spi.tx_num--;
+		memmove(sim_spi.tx, sim_spi.tx + 1, sim_spi.tx_num * sizeof(sim_spi.tx[0]));
+		if((SIM_SF0CTRLH & SIM_SF0SIZE) == 0) {
+			rx = sim_spi_byte((unsigned char)tx);
+		} else if(SIM_SF0CTRLL & SIM_SF0MSB) {
+			rx = (unsigned short)(sim_spi_byte((unsigned char)(tx >> 8)) << 8);
+			rx |= sim_spi_byte((unsigned char)tx);
+		} else {
+			rx = sim_spi_byte((unsigned char)tx);
+			rx |= (unsigned short)(sim_spi_byte((unsigned char)(tx >> 8)) << 8);
+		}
+		if(sim_spi.rx_num < SIM_SPI_FIFO) sim_spi.rx[sim_spi.rx_num++] = rx;
+		SIM_SF0DRR = sim_spi.rx[0];
+		if(sim_spi.tx_num != 0) {
+			sim_spi_frame_start(sim_spi.done);
+			continue;
+		}
+		sim_spi.busy = 0;
+		SIM_SF0INT |= SIM_SF0SPIF;
+		if(SIM_SF0INT & SIM_SF0SPIE) SIM_REG8(0x01A) |= 0x02;		// QSIOF0
+	}
+}
+
+void sim_spi_shift(SIM_TIME t)
+{
+	if(sim_spi.busy) sim_spi.done += t;
+}
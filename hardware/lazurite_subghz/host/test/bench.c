@@ -0,0 +1,159 @@
+/* FILE NAME: bench.c
+ *
+ * Copyright (c) 2015  Lapis Semiconductor Co.,Ltd.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+
+// micro benchmarks of hot paths. time per call is measured on host and it is
+// useful only to compare the implementations, not to estimate time on MCU.
+// acc/call is register accesses per call, and sim us/call and cyc/call are time of
+// hardware in the simulation (bus transfer, wait of timer) in usec and in cycles of
+// HSCLK(16MHz). CPU cycles of C code are not simulated, and they need the simulator
+// of U16 IDE.
+
+#include "common.h"
+#include "print.h"
+#include "driver_uart.h"
+#include "Wire.h"
+#include "sim.h"
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#define BENCH_LOOP	1000000L
+
+static double bench_ns(struct timespec *t0, struct timespec *t1, long loop)
+{
+	return ((double)(t1->tv_sec - t0->tv_sec) * 1e9 + (double)(t1->tv_nsec - t0->tv_nsec)) / loop;
+}
+
+#define BENCH_N(name, loop, stmt) do { \
+		struct timespec t0, t1; \
+		unsigned long acc = sim_stat.access; \
+		SIM_TIME st = sim_time; \
+		long i; \
+		clock_gettime(CLOCK_MONOTONIC, &t0); \
+		for(i = 0; i < (loop); i++) { stmt; } \
+		clock_gettime(CLOCK_MONOTONIC, &t1); \
+		printf("%-24s %8.1f ns/call %8.1f acc/call %8.2f sim us/call %8.1f cyc/call\n", name, \
+			bench_ns(&t0, &t1, (loop)), (double)(sim_stat.access - acc) / (loop), \
+			(double)(sim_time - st) / 512 / (loop), (double)(sim_time - st) / SIM_CYCLE / (loop)); \
+	} while(0)
+#define BENCH(name, stmt)	BENCH_N(name, BENCH_LOOP, stmt)
+
+// cost of Print.p() against fill level of the buffer. 8 bytes are appended until
+// the buffer is full, and time is summed for each 1/4 of the buffer.
+// previous printBuf() scanned the buffer by strlen(strncat()) on every append.
+#define FILL_BUF	4096
+#define FILL_STEP	(FILL_BUF / 4)
+#define FILL_LOOP	2000L
+
+static char *prev_buf;
+static unsigned short prev_size;
+static unsigned short prev_len;
+
+static void prev_init(char* x, unsigned short size)
+{
+	prev_buf = x;
+	prev_size = size - 1;
+	prev_len = 0;
+	*prev_buf = '\0';
+}
+
+static int prev_printBuf(const char* data)
+{
+	prev_len = strlen(strncat(prev_buf, data, prev_size - prev_len));
+	return prev_size - prev_len;
+}
+
+static void bench_fill(const char *name, void (*init)(char* buf, unsigned short size), int (*append)(const char* data))
+{
+	static char buf[FILL_BUF];
+	double ns[FILL_BUF / FILL_STEP] = { 0 };
+	struct timespec t0, t1;
+	long loop;
+	int k, j;
+
+	for(loop = 0; loop < FILL_LOOP; loop++) {
+		init(buf, sizeof(buf));
+		for(k = 0; k < FILL_BUF / FILL_STEP; k++) {
+			clock_gettime(CLOCK_MONOTONIC, &t0);
+			for(j = 0; j < FILL_STEP / 8; j++) append("abcdefgh");
+			clock_gettime(CLOCK_MONOTONIC, &t1);
+			ns[k] += bench_ns(&t0, &t1, FILL_STEP / 8);
+		}
+	}
+	printf("%-24s", name);
+	for(k = 0; k < FILL_BUF / FILL_STEP; k++) printf(" %8.1f", ns[k] / FILL_LOOP);
+	printf(" ns/append at fill 0-1K/1K-2K/2K-3K/3K-4K\n");
+}
+
+// I2C device which acknowledges everything
+static unsigned char dev_ack(unsigned char data)
+{
+	return 1;
+}
+static unsigned char dev_read(unsigned char ack)
+{
+	return 0;
+}
+static const SIM_I2C_DEV dev = { 0x48, dev_ack, dev_ack, dev_read, NULL };
+
+int main(void)
+{
+	static char buf[64];
+	static char line[64];
+	static UCHAR fifo_buf[128];
+	static FIFO_CTRL fifo = { sizeof(fifo_buf), fifo_buf, 0, 0, 0 };
+	volatile size_t sink = 0;
+
+	sim_reset();
+	BENCH("printNumber(DEC)", sink += printNumber(buf, 1234567L + i, DEC));
+	BENCH("printNumber(HEX)", sink += printNumber(buf, 0x1234567L + i, HEX));
+	BENCH("printFloat(3)", sink += printFloat(buf, 1234.5678 + (double)i, 3));
+	BENCH("printFixed(3)", sink += printFixed(buf, 1234567L + i, 3));
+	BENCH("Print line", {
+		Print.init(line, sizeof(line));
+		Print.p("t=");
+		Print.l(i, DEC);
+		Print.p(",v=");
+		Print.fx(i, 2);
+		Print.ln();
+	});
+	bench_fill("Print.p 8 bytes", Print.init, Print.p);
+	bench_fill("previous Print.p 8 bytes", prev_init, prev_printBuf);
+	BENCH("uart_fifo in/out", {
+		uart_fifo_in(&fifo, (UCHAR)i);
+		sink += uart_fifo_out(&fifo);
+	});
+
+	sim_boot();
+	sim_i2c_attach(1, &dev);
+	Wire.begin();
+	BENCH_N("millis()", 100000L, sink += millis());
+	BENCH_N("Wire write 4 bytes", 10000L, {
+		Wire.beginTransmission(0x48);
+		Wire.write((const uint8_t *)"\x00\x01\x02\x03", 4);
+		sink += Wire.endTransmission(true);
+	});
+	BENCH_N("Wire writeRead 1+4 bytes", 10000L, {
+		uint8_t reg = 0;
+		sink += Wire.writeRead(0x48, &reg, 1, (uint8_t *)buf, 4);
+	});
+	return (int)(sink & 0);
+}
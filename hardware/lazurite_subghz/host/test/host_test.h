@@ -0,0 +1,52 @@
+/* FILE NAME: host_test.h
+ *
+ * Copyright (c) 2015  Lapis Semiconductor Co.,Ltd.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef _HOST_TEST_H_
+#define _HOST_TEST_H_
+
+#include <stdio.h>
+
+//********************************************************************************
+//   check macros of host tests
+//********************************************************************************
+static int host_test_fail = 0;
+static int host_test_count = 0;
+
+#define CHECK(cond) do { \
+		host_test_count++; \
+		if(!(cond)) { \
+			host_test_fail++; \
+			printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+		} \
+	} while(0)
+
+#define CHECK_STR(a,b) do { \
+		host_test_count++; \
+		if(strcmp((a),(b)) != 0) { \
+			host_test_fail++; \
+			printf("%s:%d: \"%s\" != \"%s\"\n", __FILE__, __LINE__, (a), (b)); \
+		} \
+	} while(0)
+
+#define TEST_RESULT() \
+	(printf("%d checks, %d failed\n", host_test_count, host_test_fail), host_test_fail ? 1 : 0)
+
+#endif // _HOST_TEST_H_
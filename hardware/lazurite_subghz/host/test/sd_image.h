@@ -0,0 +1,107 @@
+/* FILE NAME: sd_image.h
+ *
+ * Copyright (c) 2015  Lapis Semiconductor Co.,Ltd.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef _SD_IMAGE_H_
+#define _SD_IMAGE_H_
+
+#include <stdlib.h>
+#include <string.h>
+
+//********************************************************************************
+//   empty FAT volume for the SD card of sim_sd.c
+//   block 0 is MBR, and partition 1 starts at SD_IMAGE_PART.
+//   FAT16: 4 blocks per cluster, 512 root entries. FAT32: 1 block per cluster.
+//   blocks of FAT32 must be more than 65525 + SD_IMAGE_PART + 32 + FAT.
+//********************************************************************************
+#define SD_IMAGE_PART		8
+
+static void sd_image_put16(unsigned char *p, unsigned short v)
+{
+	p[0] = (unsigned char)v;
+	p[1] = (unsigned char)(v >> 8);
+}
+
+static void sd_image_put32(unsigned char *p, unsigned long v)
+{
+	sd_image_put16(p, (unsigned short)v);
+	sd_image_put16(p + 2, (unsigned short)(v >> 16));
+}
+
+static unsigned char* sd_image_format(unsigned long blocks, unsigned char fat32)
+{
+	unsigned char *img = calloc(blocks, 512);
+	unsigned char *mbr = img;
+	unsigned char *bs = img + SD_IMAGE_PART * 512;
+	unsigned long total = blocks - SD_IMAGE_PART;
+	unsigned char spc = fat32 ? 1 : 4;
+	unsigned short reserved = fat32 ? 32 : 1;
+	unsigned short root_entries = fat32 ? 0 : 512;
+	unsigned long fat_size = fat32 ? ((total / spc + 2) * 4 + 511) / 512 : ((total / spc + 2) * 2 + 511) / 512;
+	unsigned char *fat;
+	unsigned char i;
+
+	if(img == NULL) return NULL;
+
+	// partition 1
+	mbr[446 + 4] = fat32 ? 0x0C : 0x06;
+	sd_image_put32(&mbr[446 + 8], SD_IMAGE_PART);
+	sd_image_put32(&mbr[446 + 12], total);
+	mbr[510] = 0x55;
+	mbr[511] = 0xAA;
+
+	// boot sector
+	bs[0] = 0xEB; bs[1] = 0x3C; bs[2] = 0x90;
+	memcpy(&bs[3], "LAZURITE", 8);
+	sd_image_put16(&bs[11], 512);
+	bs[13] = spc;
+	sd_image_put16(&bs[14], reserved);
+	bs[16] = 2;
+	sd_image_put16(&bs[17], root_entries);
+	if(!fat32 && (total < 0x10000)) sd_image_put16(&bs[19], (unsigned short)total);
+	else sd_image_put32(&bs[32], total);
+	bs[21] = 0xF8;
+	sd_image_put32(&bs[28], SD_IMAGE_PART);
+	if(fat32) {
+		sd_image_put32(&bs[36], fat_size);
+		sd_image_put32(&bs[44], 2);					// root directory cluster
+	} else {
+		sd_image_put16(&bs[22], (unsigned short)fat_size);
+	}
+	bs[510] = 0x55;
+	bs[511] = 0xAA;
+
+	// reserved clusters and root directory of FAT32
+	for(i = 0; i < 2; i++)
+	{
+		fat = bs + (reserved + i * fat_size) * 512;
+		if(fat32) {
+			sd_image_put32(&fat[0], 0x0FFFFFF8);
+			sd_image_put32(&fat[4], 0x0FFFFFFF);
+			sd_image_put32(&fat[8], 0x0FFFFFFF);
+		} else {
+			sd_image_put16(&fat[0], 0xFFF8);
+			sd_image_put16(&fat[2], 0xFFFF);
+		}
+	}
+	return img;
+}
+
+#endif // _SD_IMAGE_H_
@@ -0,0 +1,247 @@
+/* FILE NAME: test_arducam.c
+ *
+ * Copyright (c) 2015  Lapis Semiconductor Co.,Ltd.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "common.h"
+#include "lazurite.h"
+#include "pin_assignment.h"
+#include "spi.h"
+#include "ArduCAM.h"
+#include "sim.h"
+#include "host_test.h"
+#include <string.h>
+
+// FIFO of ArduChip on SIOF0. read_fifo(), readFifoBurst() and streamFifo() read a
+// captured image, and bytes/s and bus transactions (CS low) per image are reported.
+// first byte after CS low is the register address. bit 7 = 1 is write.
+
+#define CAM_CS_PIN		9
+#define IMAGE_LEN		30000
+
+#define CAM_CMD			0
+#define CAM_WRITE		1
+#define CAM_READ		2
+#define CAM_BURST		3
+#define CAM_SINGLE		4
+#define CAM_DONE		5
+
+static unsigned char image[IMAGE_LEN];
+static unsigned char out[IMAGE_LEN];
+static unsigned long fifo_len;
+static unsigned long fifo_rd;
+static unsigned char cam_pin;
+static unsigned char cam_cs;
+static unsigned char cam_state;
+static unsigned char cam_addr;
+static unsigned long cam_select;			// bus transactions
+
+static unsigned char cam_fifo(void)
+{
+	return (fifo_rd < fifo_len) ? image[fifo_rd++] : 0x00;
+}
+
+static unsigned char cam_reg(unsigned char addr)
+{
+	switch(addr)
+	{
+	case ARDUCHIP_TRIG:
+		return CAP_DONE_MASK;
+	case FIFO_SIZE1:
+		return (unsigned char)fifo_len;
+	case FIFO_SIZE2:
+		return (unsigned char)(fifo_len >> 8);
+	case FIFO_SIZE3:
+		return (unsigned char)(fifo_len >> 16);
+	default:
+		return 0x00;
+	}
+}
+
+static unsigned char cam_exchange(unsigned char mosi)
+{
+	unsigned char miso = 0x00;
+
+	if(!cam_cs) return 0xFF;
+	switch(cam_state)
+	{
+	case CAM_CMD:
+		cam_addr = mosi;
+		if(mosi & 0x80) cam_state = CAM_WRITE;
+		else if(mosi == BURST_FIFO_READ) cam_state = CAM_BURST;
+		else if(mosi == SINGLE_FIFO_READ) cam_state = CAM_SINGLE;
+		else cam_state = CAM_READ;
+		break;
+	case CAM_WRITE:
+		if(((cam_addr & 0x7F) == ARDUCHIP_FIFO) && (mosi & FIFO_CLEAR_MASK)) fifo_rd = 0;
+		cam_state = CAM_DONE;
+		break;
+	case CAM_READ:
+		miso = cam_reg(cam_addr);
+		cam_state = CAM_DONE;
+		break;
+	case CAM_BURST:
+		miso = cam_fifo();
+		break;
+	case CAM_SINGLE:
+		miso = cam_fifo();
+		cam_state = CAM_DONE;
+		break;
+	default:
+		break;
+	}
+	return miso;
+}
+
+static void cam_gpio(unsigned char pin, unsigned char level)
+{
+	if(pin != cam_pin) return;
+	if(!level && !cam_cs) {
+		cam_state = CAM_CMD;
+		cam_select++;
+	}
+	cam_cs = !level;
+}
+
+// captured image. JPEG markers and pseudo random data
+static void cam_capture(unsigned long len)
+{
+	unsigned long i, r = 1;
+
+	for(i = 0; i < len; i++)
+	{
+		r = r * 1103515245UL + 12345UL;
+		image[i] = (unsigned char)(r >> 16);
+	}
+	image[0] = 0xFF; image[1] = 0xD8;
+	image[len - 2] = 0xFF; image[len - 1] = 0xD9;
+	fifo_len = len;
+	fifo_rd = 0;
+}
+
+static void cam_begin(void)
+{
+	sim_boot();
+	cam_pin = digital_pin_to_port[CAM_CS_PIN];
+	cam_cs = 0;
+	sim_spi_attach(cam_exchange);
+	sim_gpio_hook(cam_gpio);
+	SPI.begin();
+	ArduCAM.init(OV5642, CAM_CS_PIN);
+	cam_capture(IMAGE_LEN);
+}
+
+static unsigned long sink_pos;
+static unsigned short sink_calls;
+static unsigned short sink_stop;
+static bool sink(const uint8_t *data, uint16_t len)
+{
+	if(++sink_calls == sink_stop) return false;
+	memcpy(&out[sink_pos], data, len);
+	sink_pos += len;
+	return true;
+}
+
+static unsigned long spi_bytes(void)
+{
+	SIM_SPI_STAT stat;
+
+	sim_spi_stat(&stat);
+	return stat.bytes;
+}
+
+static void report(const char *name, SIM_TIME t, unsigned long len, unsigned long select, unsigned long bytes)
+{
+	printf("%-22s %7.0f bytes/s %6lu transactions %6lu bytes on bus\n", name,
+		(double)len * 512000000.0 / (double)t, select, bytes);
+}
+
+// 1 transaction of 2 bytes for each byte of the image
+static void test_read_fifo(void)
+{
+	SIM_TIME t;
+	unsigned long i, select, bytes;
+
+	cam_begin();
+	memset(out, 0, sizeof(out));
+	select = cam_select;
+	bytes = spi_bytes();
+	t = sim_time;
+	for(i = 0; i < IMAGE_LEN; i++) out[i] = ArduCAM.read_fifo();
+	t = sim_time - t;
+	CHECK(memcmp(out, image, IMAGE_LEN) == 0);
+	CHECK(cam_select - select == IMAGE_LEN);
+	CHECK(spi_bytes() - bytes == IMAGE_LEN * 2);
+	report("read_fifo", t, IMAGE_LEN, cam_select - select, spi_bytes() - bytes);
+}
+
+// length by read_fifo_length() (3 register reads) and 1 burst for each chunk
+static void test_stream(unsigned short chunk)
+{
+	static uint8_t buf[1024];
+	char name[32];
+	SIM_TIME t;
+	unsigned long select, bytes, bursts = (IMAGE_LEN + chunk - 1) / chunk;
+
+	cam_begin();
+	memset(out, 0, sizeof(out));
+	sink_pos = 0;
+	sink_calls = 0;
+	sink_stop = 0;
+	select = cam_select;
+	bytes = spi_bytes();
+	t = sim_time;
+	CHECK(ArduCAM.streamFifo(buf, chunk, 0, sink) == IMAGE_LEN);
+	t = sim_time - t;
+	CHECK(sink_pos == IMAGE_LEN);
+	CHECK(memcmp(out, image, IMAGE_LEN) == 0);
+	CHECK(cam_select - select == 3 + bursts);
+	CHECK(spi_bytes() - bytes == IMAGE_LEN + bursts + 3 * 2);
+	sprintf(name, "streamFifo chunk %u", chunk);
+	report(name, t, IMAGE_LEN, cam_select - select, spi_bytes() - bytes);
+}
+
+// sink stops the stream, and the next burst continues from the next byte of FIFO
+static void test_stream_stop(void)
+{
+	static uint8_t buf[64];
+
+	cam_begin();
+	memset(out, 0, sizeof(out));
+	sink_pos = 0;
+	sink_calls = 0;
+	sink_stop = 3;
+	CHECK(ArduCAM.streamFifo(buf, sizeof(buf), IMAGE_LEN, sink) == 2 * sizeof(buf));
+	CHECK(memcmp(out, image, 2 * sizeof(buf)) == 0);
+	CHECK(ArduCAM.readFifoBurst(buf, sizeof(buf)) == sizeof(buf));
+	CHECK(memcmp(buf, &image[3 * sizeof(buf)], sizeof(buf)) == 0);
+
+	// FIFO larger than ArduChip is rejected
+	CHECK(ArduCAM.streamFifo(buf, sizeof(buf), MAX_FIFO_SIZE + 1, sink) == 0);
+}
+
+int main(void)
+{
+	test_read_fifo();
+	test_stream(32);
+	test_stream(256);
+	test_stream(1024);
+	test_stream_stop();
+	return TEST_RESULT();
+}
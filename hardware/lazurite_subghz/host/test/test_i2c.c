@@ -0,0 +1,239 @@
+/* FILE NAME: test_i2c.c
+ *
+ * Copyright (c) 2015  Lapis Semiconductor Co.,Ltd.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "common.h"
+#include "lazurite.h"
+#include "Wire.h"
+#include "sim.h"
+#include "host_test.h"
+#include <string.h>
+
+// Wire and the interrupt path of driver_i2c.c against a register device on I2C1.
+// the first byte of a write is the register pointer, and reads continue from it.
+
+#define DEV_ADDRESS		0x48
+
+static unsigned char dev_reg[16];
+static unsigned char dev_ptr;
+static unsigned char dev_first;
+
+static unsigned char dev_start(unsigned char read)
+{
+	dev_first = !read;
+	return 1;
+}
+
+static unsigned char dev_write(unsigned char data)
+{
+	if(dev_first)
+	{
+		dev_ptr = data & 0x0F;
+		dev_first = 0;
+	}
+	else
+	{
+		dev_reg[dev_ptr] = data;
+		dev_ptr = (dev_ptr + 1) & 0x0F;
+	}
+	return 1;
+}
+
+static unsigned char dev_read(unsigned char ack)
+{
+	unsigned char data = dev_reg[dev_ptr];
+	dev_ptr = (dev_ptr + 1) & 0x0F;
+	return data;
+}
+
+static const SIM_I2C_DEV dev = { DEV_ADDRESS, dev_start, dev_write, dev_read, NULL };
+
+static volatile unsigned char xfer_done;
+static void xfer_callback(I2C_XFER *xfer)
+{
+	xfer_done++;
+}
+
+static void wire_begin(void)
+{
+	// static state of drivers is kept by sim_boot(). LTBC handler of the watchdog of
+	// previous sequence is detached at the next count before LTBC is initialized again
+	sim_clock_advance(10000);
+	sim_boot();
+	memset(dev_reg, 0, sizeof(dev_reg));
+	dev_ptr = 0;
+	sim_i2c_attach(1, &dev);
+	Wire.begin();
+}
+
+static void test_write_read(void)
+{
+	static const uint8_t data[] = { 0x02, 0x11, 0x22, 0x33 };
+	uint8_t reg = 0x02;
+	uint8_t rx[3];
+	SIM_I2C_STAT stat;
+	SIM_TIME t;
+
+	wire_begin();
+
+	// 1 address + 4 data bytes by 400kHz = 5 x 9 bits + start/stop
+	t = sim_time;
+	Wire.beginTransmission(DEV_ADDRESS);
+	Wire.write(data, sizeof(data));
+	CHECK(Wire.endTransmission(true) == I2C_RESULT_OK);
+	t = sim_time - t;
+	CHECK(dev_reg[2] == 0x11 && dev_reg[3] == 0x22 && dev_reg[4] == 0x33);
+	sim_i2c_stat(1, &stat);
+	CHECK(stat.bytes == 5 && stat.start == 1 && stat.stop == 1);
+	CHECK(t >= SIM_US(115) && t < SIM_US(200));
+	printf("write 4 bytes: %llu us, %lu halt\n", t / 512, sim_stat.halt[0] + sim_stat.halt[1]);
+
+	// pointer and 3 bytes by repeated start
+	memset(rx, 0, sizeof(rx));
+	CHECK(Wire.writeRead(DEV_ADDRESS, &reg, 1, rx, sizeof(rx)) == I2C_RESULT_OK);
+	CHECK(rx[0] == 0x11 && rx[1] == 0x22 && rx[2] == 0x33);
+	sim_i2c_stat(1, &stat);
+	CHECK(stat.bytes == 5 + 2 + 1 + 3 && stat.start == 3 && stat.stop == 2);
+
+	// requestFrom continues from the pointer of the device
+	dev_ptr = 3;
+	CHECK(Wire.requestFrom(DEV_ADDRESS, 2, true) == 2);
+	CHECK(Wire.available() == 2);
+	CHECK(Wire.read() == 0x22);
+	CHECK(Wire.read() == 0x33);
+	CHECK(Wire.read() == -1);
+	CHECK(Wire.getErrorCount(DEV_ADDRESS) == 0);
+}
+
+static void test_nack(void)
+{
+	wire_begin();
+
+	Wire.beginTransmission(DEV_ADDRESS + 1);
+	Wire.write_byte(0x00);
+	CHECK(Wire.endTransmission(true) == I2C_RESULT_ANACK);
+	CHECK(Wire.getErrorCount(DEV_ADDRESS + 1) == 1);
+
+	// bus is usable after NACK
+	Wire.beginTransmission(DEV_ADDRESS);
+	Wire.write_byte(0x05);
+	Wire.write_byte(0xA5);
+	CHECK(Wire.endTransmission(true) == I2C_RESULT_OK);
+	CHECK(dev_reg[5] == 0xA5);
+}
+
+static void test_async(void)
+{
+	static uint8_t tx[2][2] = { { 0x08, 0x01 }, { 0x09, 0x02 } };
+	static I2C_XFER xfer[2];
+	int i;
+
+	wire_begin();
+	xfer_done = 0;
+	for(i = 0; i < 2; i++)
+	{
+		memset(&xfer[i], 0, sizeof(I2C_XFER));
+		xfer[i].address = DEV_ADDRESS;
+		xfer[i].tx_buf = tx[i];
+		xfer[i].tx_len = 2;
+		xfer[i].stop = true;
+		xfer[i].callback = xfer_callback;
+		CHECK(Wire.submit(&xfer[i]) == true);
+	}
+	CHECK(Wire.poll() == 2);
+
+	// CPU runs without access to the driver
+	while(Wire.poll() != 0) sim_clock_advance(10);
+	CHECK(xfer_done == 2);
+	CHECK(xfer[0].result == I2C_RESULT_OK && xfer[1].result == I2C_RESULT_OK);
+	CHECK(dev_reg[8] == 0x01 && dev_reg[9] == 0x02);
+}
+
+// slave holds SDA, and sequence is stopped by timeout of LTBC
+static void test_timeout(void)
+{
+	SIM_TIME t;
+
+	wire_begin();
+	Wire.setTimeout(10);
+
+	// slave holds SDA until 5 clocks of SCL by recovery
+	sim_i2c_stuck(1, 5);
+	t = sim_time;
+	Wire.beginTransmission(DEV_ADDRESS);
+	Wire.write_byte(0x01);
+	Wire.write_byte(0x5A);
+	CHECK(Wire.endTransmission(true) == I2C_RESULT_TIMEOUT);
+	t = sim_time - t;
+	CHECK(t >= SIM_MS(10) && t < SIM_MS(30));
+	CHECK(Wire.getErrorCount(DEV_ADDRESS) == 1);
+	printf("timeout 10 ms: %llu us\n", t / 512);
+
+	// bus is recovered and the next sequence is completed
+	Wire.beginTransmission(DEV_ADDRESS);
+	Wire.write_byte(0x01);
+	Wire.write_byte(0x5A);
+	CHECK(Wire.endTransmission(true) == I2C_RESULT_OK);
+	CHECK(dev_reg[1] == 0x5A);
+}
+
+// asynchronous transaction is completed by timeout, and the next one in the queue is
+// started after the bus is recovered by Wire.poll()
+static void test_async_timeout(void)
+{
+	static uint8_t tx[2][2] = { { 0x0A, 0x11 }, { 0x0B, 0x22 } };
+	static I2C_XFER xfer[2];
+	int i;
+
+	wire_begin();
+	Wire.setTimeout(10);
+	sim_i2c_stuck(1, 5);
+	xfer_done = 0;
+	for(i = 0; i < 2; i++)
+	{
+		memset(&xfer[i], 0, sizeof(I2C_XFER));
+		xfer[i].address = DEV_ADDRESS;
+		xfer[i].tx_buf = tx[i];
+		xfer[i].tx_len = 2;
+		xfer[i].stop = true;
+		xfer[i].callback = xfer_callback;
+		CHECK(Wire.submit(&xfer[i]) == true);
+	}
+
+	// second transaction waits for recovery in task context
+	while(xfer_done == 0) sim_clock_advance(10);
+	CHECK(xfer[0].result == I2C_RESULT_TIMEOUT);
+	sim_clock_advance(20000);
+	CHECK(xfer_done == 1);
+	while(Wire.poll() != 0) sim_clock_advance(10);
+	CHECK(xfer_done == 2);
+	CHECK(xfer[1].result == I2C_RESULT_OK);
+	CHECK(dev_reg[10] == 0x00 && dev_reg[11] == 0x22);
+}
+
+int main(void)
+{
+	test_write_read();
+	test_nack();
+	test_async();
+	test_timeout();
+	test_async_timeout();
+	return TEST_RESULT();
+}
@@ -0,0 +1,115 @@
+/* FILE NAME: test_print.c
+ *
+ * Copyright (c) 2015  Lapis Semiconductor Co.,Ltd.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "common.h"
+#include "print.h"
+#include "host_test.h"
+
+static void test_printNumber(void)
+{
+	char buf[40];
+
+	CHECK(printNumber(buf,0,DEC) == 1);
+	CHECK_STR(buf,"0");
+	printNumber(buf,65535,DEC);
+	CHECK_STR(buf,"65535");
+	printNumber(buf,65536,DEC);
+	CHECK_STR(buf,"65536");
+	printNumber(buf,2147483647L,DEC);
+	CHECK_STR(buf,"2147483647");
+	CHECK(printNumber(buf,-2147483647L-1,DEC) == 11);
+	CHECK_STR(buf,"-2147483648");
+	printNumber(buf,0xA5,BIN);
+	CHECK_STR(buf,"10100101");
+	printNumber(buf,0755,OCT);
+	CHECK_STR(buf,"755");
+	printNumber(buf,0x7FFFABCDL,HEX);
+	CHECK_STR(buf,"7FFFABCD");
+	printNumber(buf,35,36);
+	CHECK_STR(buf,"Z");
+}
+
+static void test_printFloat(void)
+{
+	char buf[40];
+
+	printFloat(buf,0.0,2);
+	CHECK_STR(buf,"0.00");
+	printFloat(buf,3.14159,3);
+	CHECK_STR(buf,"3.142");
+	printFloat(buf,-2.5,0);
+	CHECK_STR(buf,"-3");
+	printFloat(buf,9.9996,3);
+	CHECK_STR(buf,"10.000");
+	printFloat(buf,23.875,2);
+	CHECK_STR(buf,"23.88");
+	printFloat(buf,-0.001,4);
+	CHECK_STR(buf,"-0.0010");
+	printFloat(buf,3e9,2);
+	CHECK_STR(buf,"ovf");
+	// carry of rounding at the limit of the integer part
+	printFloat(buf,2147483647.4,0);
+	CHECK_STR(buf,"2147483647");
+	printFloat(buf,2147483647.5,0);
+	CHECK_STR(buf,"2147483648");
+	printFloat(buf,-2147483647.5,0);
+	CHECK_STR(buf,"-2147483648");
+	printFloat(buf,2147483647.4996,3);
+	CHECK_STR(buf,"2147483647.500");
+}
+
+static void test_printFixed(void)
+{
+	char buf[40];
+
+	printFixed(buf,-12345,2);
+	CHECK_STR(buf,"-123.45");
+	printFixed(buf,5,3);
+	CHECK_STR(buf,"0.005");
+	printFixed(buf,42,0);
+	CHECK_STR(buf,"42");
+}
+
+static void test_print_buffer(void)
+{
+	char buf[8];
+
+	Print.init(buf,sizeof(buf));
+	CHECK(Print.p("abc") == 4);
+	CHECK(Print.l(12,DEC) == 2);
+	CHECK_STR(buf,"abc12");
+	CHECK(Print.ovf() == 0);
+	Print.p("xyz");
+	CHECK_STR(buf,"abc12xy");
+	CHECK(Print.len() == 7);
+	CHECK(Print.ovf() == 1);
+	Print.ln();
+	CHECK_STR(buf,"abc12x\n");
+}
+
+int main(void)
+{
+	test_printNumber();
+	test_printFloat();
+	test_printFixed();
+	test_print_buffer();
+	return TEST_RESULT();
+}
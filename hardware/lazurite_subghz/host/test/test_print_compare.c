@@ -0,0 +1,245 @@
+/* FILE NAME: test_print_compare.c
+ *
+ * Copyright (c) 2015  Lapis Semiconductor Co.,Ltd.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+
+// compare printNumber and printFloat with the previous implementation, which
+// used a division per digit and double operations, over a random corpus.
+// printNumber shall be identical. printFloat shall be the correctly rounded
+// result of the binary value with half up. the previous printFloat differs on
+// exact halves (23.875 -> "23.87") and on values close to a half, where adding
+// the rounding offset in double moved the value across the half. current
+// printFloat scales the fraction in double too, so a value within 1 ulp of
+// the half may still be rounded to the other side. it is counted, not failed.
+
+#include "common.h"
+#include "print.h"
+#include "host_test.h"
+
+#define COMPARE_NUMBER		1000000L
+#define COMPARE_FLOAT		3000000L
+
+static unsigned long rnd_state = 0x12345678UL;
+
+static unsigned long rnd32(void)
+{
+	rnd_state ^= (rnd_state << 13) & 0xFFFFFFFFUL;
+	rnd_state ^= rnd_state >> 17;
+	rnd_state ^= (rnd_state << 5) & 0xFFFFFFFFUL;
+	return rnd_state;
+}
+
+// printNumber of previous version
+static size_t old_printNumber(char * x, long data, unsigned char base)
+{
+	char buf[33];
+	unsigned char digit = 0;
+	char sign = 0;
+	unsigned long n;
+	unsigned long m;
+	char c;
+	size_t i;
+	if (base < 2) base = 10;
+	n = (unsigned long)data;
+
+	if((base == DEC) && (data < 0))
+	{
+		sign = 1;
+		n = ~n;
+		n += 1;
+	}
+
+	do {
+		m = n;
+		n /= base;
+		c = (char)(m - base * n);
+		buf[digit] = (char)(c < 10 ? c + '0' : c + 'A' - 10);
+		digit++;
+	} while(n);
+
+	if((base == DEC) && (sign == 1))
+	{
+		buf[digit] = '-';
+		digit++;
+	}
+
+	for(i=0;i<(size_t)digit;i++)
+	{
+		x[i] = buf[digit-i-1];
+	}
+	x[i] = '\0';
+	return i;
+}
+
+// printFloat of previous version
+static size_t old_printFloat(char* x, double data, unsigned char digit)
+{
+	long m;
+	double round;
+	size_t n = 0;
+	unsigned char i;
+	static const char s[] = "ovf";
+
+	if((data > 2147483647.5)||(data < -2147483647.5))
+	{
+		strcpy(x,s);
+		return sizeof(s);
+	}
+
+	if(data < 0)
+	{
+		data *= -1;
+		x[n++] = '-';
+	}
+	round = 0.5;
+	for(i=0;i<digit;++i)
+	{
+		round /= 10;
+	}
+	data += round;
+
+	m=(long)data;
+
+	n += old_printNumber(x+n,m,DEC);
+
+	if(digit == 0) return n;
+
+	x[n++] = '.';
+
+	data -= m;
+	for(i=0;i<digit;i++)
+	{
+		data *= 10;
+		m = (long)data;
+		if(m==0)
+		{
+			x[n++] = '0';
+		}
+	}
+
+	if( m != 0 )
+	{
+		 n += old_printNumber(x+n,m,DEC);
+	}
+	else
+	{
+		x[n++] = '\0';
+	}
+
+	return n;
+}
+
+// true when data is exactly on the half of the last digit
+static bool is_half(double data, unsigned char digit)
+{
+	long double v = (data < 0) ? -(long double)data : (long double)data;
+	unsigned char i;
+	for(i = 0; i < digit; i++) v *= 10;
+	return (v - (long double)(unsigned long)v) == 0.5L;
+}
+
+// true when data is so close to the half of the last digit that the scaling in
+// double, which has rounding error of about 1 ulp, cannot decide the direction.
+static bool is_near_half(double data, unsigned char digit)
+{
+	long double v = (data < 0) ? -(long double)data : (long double)data;
+	long double d;
+	unsigned char i;
+	for(i = 0; i < digit; i++) v *= 10;
+	d = v - (long double)(unsigned long)v - 0.5L;
+	if(d < 0) d = -d;
+	return d <= v * 0x1p-51L;
+}
+
+// correctly rounded result of binary value of data. half is rounded up (away from 0).
+static void ref_printFloat(char* x, double data, unsigned char digit)
+{
+	long double v = (long double)data;
+	long double e = 0.25L;						// less than half of the last digit
+	unsigned char i;
+	for(i = 0; i < digit; i++) e /= 10;
+	if(is_half(data, digit)) v += (data < 0) ? -e : e;
+	snprintf(x, 40, "%.*Lf", digit, v);
+}
+
+static void compare_number(void)
+{
+	static const unsigned char base[] = { BIN, OCT, DEC, HEX, 36 };
+	char a[40], b[40];
+	long i, diff = 0;
+	long data;
+
+	for(i = 0; i < COMPARE_NUMBER; i++)
+	{
+		data = (long)(int)rnd32();					// 32bit range of long
+		if(i & 1) data >>= (rnd32() & 31);			// include short numbers
+		if(base[i % sizeof(base)] != DEC)			// bit pattern of 32bit long, long is 64bit on host
+		{
+			data = (long)(unsigned long)(unsigned int)data;
+		}
+		printNumber(a, data, base[i % sizeof(base)]);
+		old_printNumber(b, data, base[i % sizeof(base)]);
+		if(strcmp(a, b) != 0)
+		{
+			if(diff++ < 10) printf("printNumber(%ld,%d): \"%s\" != \"%s\"\n", data, base[i % sizeof(base)], a, b);
+		}
+	}
+	printf("printNumber: %ld values, %ld differences\n", COMPARE_NUMBER, diff);
+	CHECK(diff == 0);
+}
+
+static void compare_float(void)
+{
+	static const double scale[] = { 1.0, 10.0, 1000.0, 100000.0, 1e7, 1e9 };
+	char a[40], b[40], r[40];
+	long i, wrong = 0, near = 0, half = 0, old_wrong = 0;
+	double data;
+	unsigned char digit;
+
+	for(i = 0; i < COMPARE_FLOAT; i++)
+	{
+		digit = (unsigned char)(rnd32() % 7);
+		data = (double)(int)rnd32() / scale[rnd32() % (sizeof(scale) / sizeof(scale[0]))];
+		if((i & 7) == 0) data = (double)(long)(data * 8) / 8;	// binary fractions include exact halves
+		printFloat(a, data, digit);
+		old_printFloat(b, data, digit);
+		ref_printFloat(r, data, digit);
+		if((strcmp(a, r) != 0) && is_near_half(data, digit))
+		{
+			near++;
+		}
+		else if(strcmp(a, r) != 0)
+		{
+			if(wrong++ < 10) printf("printFloat(%.17g,%d): \"%s\" != \"%s\"\n", data, digit, a, r);
+		}
+		if(strcmp(a, b) == 0) continue;
+		if(is_half(data, digit)) half++;
+		else old_wrong++;
+	}
+	printf("printFloat: %ld values, %ld not correctly rounded, %ld within 1 ulp of half\n", COMPARE_FLOAT, wrong, near);
+	printf("  differences from previous version: %ld on half, %ld by rounding error of previous version\n", half, old_wrong);
+	CHECK(wrong == 0);
+}
+
+int main(void)
+{
+	compare_number();
+	compare_float();
+	return TEST_RESULT();
+}
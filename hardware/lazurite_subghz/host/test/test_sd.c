@@ -0,0 +1,145 @@
+/* FILE NAME: test_sd.c
+ *
+ * Copyright (c) 2015  Lapis Semiconductor Co.,Ltd.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "common.h"
+#include "lazurite.h"
+#include "SD.h"
+#include "sim.h"
+#include "host_test.h"
+#include "sd_image.h"
+
+// SD library through SPI.c and the SD card of sim_sd.c on FAT16 and FAT32 volumes.
+
+#define SD_CS_PIN		10
+#define FAT16_BLOCKS	32768UL			// 16MB
+#define FAT32_BLOCKS	70000UL			// 65525 clusters or more
+
+static unsigned char data[3000];
+
+static void test_volume(unsigned char fat32, unsigned char sdhc)
+{
+	unsigned long blocks = fat32 ? FAT32_BLOCKS : FAT16_BLOCKS;
+	unsigned char *img = sd_image_format(blocks, fat32);
+	static unsigned char rd[sizeof(data)];
+	st_File_v f;
+	SIM_SD_STAT stat;
+	SIM_TIME t;
+	unsigned short i;
+
+	sim_boot();
+	sim_sd_insert(SD_CS_PIN, img, blocks, sdhc);
+	CHECK(SD.begin(SD_CS_PIN));
+	CHECK(!SD.exists("DATA.BIN"));
+
+	for(i = 0; i < sizeof(data); i++) data[i] = (unsigned char)(i * 7 + 3);
+
+	// write
+	sim_sd_stat_clear();
+	t = sim_time;
+	File.init(&f);
+	CHECK(SD.open("DATA.BIN", FILE_WRITE, &f));
+	CHECK(File.write(&f, data, sizeof(data)) == sizeof(data));
+	File.close(&f);
+	t = sim_time - t;
+	sim_sd_stat(&stat);
+	CHECK(stat.error == 0);
+	printf("FAT%d %s: write %u bytes %lu read %lu write blocks %llu us\n", fat32 ? 32 : 16,
+		sdhc ? "SDHC" : "SD2 ", (unsigned int)sizeof(data), stat.block_read, stat.block_write, t / 512);
+
+	// read
+	CHECK(SD.exists("DATA.BIN"));
+	sim_sd_stat_clear();
+	t = sim_time;
+	File.init(&f);
+	CHECK(SD.open("DATA.BIN", FILE_READ, &f));
+	CHECK(File.size(&f) == sizeof(data));
+	memset(rd, 0, sizeof(rd));
+	CHECK(File.read(&f, rd, sizeof(rd)) == sizeof(rd));
+	CHECK(memcmp(rd, data, sizeof(data)) == 0);
+	CHECK(File.read(&f, rd, 1) == 0);
+	File.close(&f);
+	t = sim_time - t;
+	sim_sd_stat(&stat);
+	CHECK(stat.error == 0);
+	printf("FAT%d %s: read %u bytes %lu read %lu write blocks %llu us\n", fat32 ? 32 : 16,
+		sdhc ? "SDHC" : "SD2 ", (unsigned int)sizeof(data), stat.block_read, stat.block_write, t / 512);
+
+	// append
+	File.init(&f);
+	CHECK(SD.open("DATA.BIN", FILE_WRITE, &f));
+	CHECK(File.write(&f, data, 10) == 10);
+	File.close(&f);
+	File.init(&f);
+	CHECK(SD.open("DATA.BIN", FILE_READ, &f));
+	CHECK(File.size(&f) == sizeof(data) + 10);
+	File.close(&f);
+
+	CHECK(SD.remove("DATA.BIN"));
+	CHECK(!SD.exists("DATA.BIN"));
+
+	// the volume is mounted again from the card
+	CHECK(SD.begin(SD_CS_PIN));
+	CHECK(!SD.exists("DATA.BIN"));
+	free(img);
+}
+
+// CMD18 is stopped by CMD12 in the middle of the stream. the byte after CMD12 is
+// data of the next block, and 0x55 is taken as R1 unless it is discarded.
+static void test_stream_stop(void)
+{
+	unsigned char *img = sd_image_format(FAT16_BLOCKS, 0);
+	static unsigned char buf[512];
+	SIM_SD_STAT stat;
+	unsigned short i;
+
+	memset(img + 100 * 512, 0x55, 8 * 512);
+	sim_boot();
+	sim_sd_insert(SD_CS_PIN, img, FAT16_BLOCKS, 1);
+	CHECK(SD.begin(SD_CS_PIN));
+	sim_sd_stat_clear();
+
+	CHECK(Sd2Card_readStart(&card, 100));
+	for(i = 0; i < 3; i++)
+	{
+		memset(buf, 0, sizeof(buf));
+		CHECK(Sd2Card_readNext(&card, buf));
+		CHECK(buf[0] == 0x55 && buf[511] == 0x55);
+	}
+	card.errorCode_ = 0;
+	CHECK(Sd2Card_readStop(&card));
+	CHECK(card.errorCode_ == 0);
+
+	// next command is in sync with the card
+	CHECK(Sd2Card_readBlock(&card, 0, buf));
+	CHECK(buf[510] == 0x55 && buf[511] == 0xAA);
+	sim_sd_stat(&stat);
+	CHECK(stat.multi_read == 1 && stat.error == 0);
+	free(img);
+}
+
+int main(void)
+{
+	test_volume(0, 0);
+	test_volume(0, 1);
+	test_volume(1, 1);
+	test_stream_stop();
+	return TEST_RESULT();
+}
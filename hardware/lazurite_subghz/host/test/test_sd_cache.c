@@ -0,0 +1,224 @@
+/* FILE NAME: test_sd_cache.c
+ *
+ * Copyright (c) 2015  Lapis Semiconductor Co.,Ltd.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "common.h"
+#include "lazurite.h"
+#include "SD.h"
+#include "sim.h"
+#include "host_test.h"
+#include "sd_image.h"
+
+// block cache of SdVolume.c on FAT16 and FAT32 images. this file and SD.c are built
+// with SD_CACHE_SLOTS = 1, 2 and 4 (test_sd_cache1/2/4), and blocks read from and
+// written to the card are counted for each operation.
+
+#define SD_CS_PIN		10
+#define FAT16_BLOCKS	32768UL
+#define FAT32_BLOCKS	70000UL
+
+// slots for data and directory blocks. slot 0 is kept for FAT with 2 or more slots
+#define DATA_SLOTS		((SD_CACHE_SLOTS > 1) ? (SD_CACHE_SLOTS - 1) : 1)
+
+static unsigned char *img;
+
+static unsigned long reads(void)
+{
+	SIM_SD_STAT stat;
+	sim_sd_stat(&stat);
+	return stat.block_read;
+}
+
+static unsigned long writes(void)
+{
+	SIM_SD_STAT stat;
+	sim_sd_stat(&stat);
+	return stat.block_write;
+}
+
+static void mount(unsigned char fat32)
+{
+	unsigned long blocks = fat32 ? FAT32_BLOCKS : FAT16_BLOCKS;
+
+	img = sd_image_format(blocks, fat32);
+	sim_boot();
+	sim_sd_insert(SD_CS_PIN, img, blocks, 1);
+	CHECK(SD.begin(SD_CS_PIN));
+	CHECK(volume.fatType_ == (fat32 ? 32 : 16));
+}
+
+// least recently used data slot is replaced
+static void test_lru(void)
+{
+	uint32_t b = volume.dataStartBlock_ + 100;
+	unsigned long r = reads();
+	uint8_t i;
+
+	for(i = 0; i < DATA_SLOTS; i++) CHECK(SdVolume_cacheRawBlock(&volume, b + i, CACHE_FOR_READ));
+	CHECK(reads() - r == DATA_SLOTS);
+	for(i = 0; i < DATA_SLOTS; i++) CHECK(SdVolume_cacheRawBlock(&volume, b + i, CACHE_FOR_READ));
+	CHECK(reads() - r == DATA_SLOTS);
+
+	// b is used again, so that b + 1 is the oldest
+	CHECK(SdVolume_cacheRawBlock(&volume, b, CACHE_FOR_READ));
+	CHECK(SdVolume_cacheRawBlock(&volume, b + DATA_SLOTS, CACHE_FOR_READ));
+	CHECK(reads() - r == DATA_SLOTS + 1);
+	CHECK(SdVolume_cacheIsCached(&volume, b + DATA_SLOTS));
+	if(DATA_SLOTS > 1) {
+		CHECK(SdVolume_cacheIsCached(&volume, b));
+		CHECK(!SdVolume_cacheIsCached(&volume, b + 1));
+	} else {
+		CHECK(!SdVolume_cacheIsCached(&volume, b));
+	}
+}
+
+// FAT block is not replaced by data blocks with 2 or more slots
+static void test_fat_slot(void)
+{
+	uint32_t b = volume.dataStartBlock_ + 200;
+	uint32_t value;
+	unsigned long r;
+	uint8_t i;
+
+	CHECK(SdVolume_fatGet(&volume, 2, &value));
+	r = reads();
+	for(i = 0; i < 8; i++)
+	{
+		CHECK(SdVolume_cacheRawBlock(&volume, b + i, CACHE_FOR_READ));
+		CHECK(SdVolume_fatGet(&volume, 2 + i, &value));
+	}
+	CHECK(reads() - r == ((SD_CACHE_SLOTS > 1) ? 8 : 16));
+	CHECK(SdVolume_cacheRawBlock(&volume, b + 8, CACHE_FOR_READ));
+	CHECK(SdVolume_cacheIsCached(&volume, volume.fatStartBlock_) == (SD_CACHE_SLOTS > 1));
+}
+
+// dirty slots are written back when replaced or flushed, and FAT block is written
+// to both FATs
+static void test_write_back(unsigned char fat32)
+{
+	uint32_t fat = volume.fatStartBlock_;
+	uint32_t mirror = fat + volume.blocksPerFat_;
+	uint32_t b = volume.dataStartBlock_ + 300;
+	unsigned long w = writes();
+	uint32_t value;
+
+	CHECK(SdVolume_fatPut(&volume, 5, 6));
+	CHECK(SdVolume_cacheRawBlock(&volume, b, CACHE_FOR_WRITE));
+	volume.cacheBuffer_->data[0] = 0xA5;
+	CHECK(writes() - w == ((SD_CACHE_SLOTS > 1) ? 0 : 2));
+	CHECK(SdVolume_cacheFlush(&volume));
+	CHECK(writes() - w == 3);
+	CHECK(SdVolume_cacheFlush(&volume));
+	CHECK(writes() - w == 3);
+
+	CHECK(img[b * 512] == 0xA5);
+	CHECK(memcmp(&img[fat * 512], &img[mirror * 512], 512) == 0);
+	value = fat32 ? (uint32_t)img[fat * 512 + 20] | ((uint32_t)img[fat * 512 + 21] << 8) :
+		(uint32_t)img[fat * 512 + 10] | ((uint32_t)img[fat * 512 + 11] << 8);
+	CHECK(value == 6);
+	CHECK(SdVolume_fatPut(&volume, 5, 0));
+	CHECK(SdVolume_cacheFlush(&volume));
+}
+
+// invalidated block is discarded without write back, and read again from the card
+static void test_invalidate(void)
+{
+	uint32_t b = volume.dataStartBlock_ + 400;
+	unsigned long r, w;
+
+	img[b * 512] = 0x11;
+	CHECK(SdVolume_cacheRawBlock(&volume, b, CACHE_FOR_WRITE));
+	volume.cacheBuffer_->data[0] = 0x22;
+	SdVolume_cacheInvalidate(&volume, b);
+	CHECK(!SdVolume_cacheIsCached(&volume, b));
+
+	w = writes();
+	CHECK(SdVolume_cacheFlush(&volume));
+	CHECK(writes() == w);
+	CHECK(img[b * 512] == 0x11);
+
+	r = reads();
+	CHECK(SdVolume_cacheRawBlock(&volume, b, CACHE_FOR_READ));
+	CHECK(reads() - r == 1);
+	CHECK(volume.cacheBuffer_->data[0] == 0x11);
+}
+
+// block reads and writes of each operation of SD library
+static void test_operations(unsigned char fat32)
+{
+	static unsigned char data[3000];
+	static unsigned char rd[sizeof(data)];
+	unsigned long r, w;
+	st_File_v f;
+	unsigned short i;
+
+	for(i = 0; i < sizeof(data); i++) data[i] = (unsigned char)(i * 13 + 1);
+	printf("FAT%d, %d slots:", fat32 ? 32 : 16, SD_CACHE_SLOTS);
+
+	r = reads(); w = writes();
+	CHECK(SD.begin(SD_CS_PIN));
+	printf(" begin %lu/%lu,", reads() - r, writes() - w);
+
+	r = reads(); w = writes();
+	File.init(&f);
+	CHECK(SD.open("LOG.TXT", FILE_WRITE, &f));
+	CHECK(File.write(&f, data, sizeof(data)) == sizeof(data));
+	File.close(&f);
+	printf(" write %lu/%lu,", reads() - r, writes() - w);
+
+	r = reads(); w = writes();
+	File.init(&f);
+	CHECK(SD.open("LOG.TXT", FILE_READ, &f));
+	CHECK(File.read(&f, rd, sizeof(rd)) == sizeof(rd));
+	File.close(&f);
+	CHECK(memcmp(rd, data, sizeof(data)) == 0);
+	CHECK(writes() == w);
+	printf(" read %lu/%lu,", reads() - r, writes() - w);
+	// only 6 data blocks. directory and FAT blocks stay in cache with 2 or more slots
+	if(SD_CACHE_SLOTS > 1) CHECK(reads() - r <= 6);
+
+	r = reads(); w = writes();
+	for(i = 0; i < 10; i++) CHECK(SD.exists("LOG.TXT"));
+	printf(" exists x10 %lu/%lu,", reads() - r, writes() - w);
+	CHECK(reads() - r <= 1);
+
+	r = reads(); w = writes();
+	CHECK(SD.remove("LOG.TXT"));
+	printf(" remove %lu/%lu blocks read/written\n", reads() - r, writes() - w);
+	CHECK(!SD.exists("LOG.TXT"));
+}
+
+static void test_volume(unsigned char fat32)
+{
+	mount(fat32);
+	test_lru();
+	test_fat_slot();
+	test_write_back(fat32);
+	test_invalidate();
+	test_operations(fat32);
+	free(img);
+}
+
+int main(void)
+{
+	test_volume(0);
+	test_volume(1);
+	return TEST_RESULT();
+}
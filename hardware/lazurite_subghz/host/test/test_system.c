@@ -0,0 +1,269 @@
+/* FILE NAME: test_system.c
+ *
+ * Copyright (c) 2015  Lapis Semiconductor Co.,Ltd.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "common.h"
+#include "lazurite.h"
+#include "driver_irq.h"
+#include "swtimer.h"
+#include "lp_manage.h"
+#include "sim.h"
+#include "host_test.h"
+
+// init(), millis/micros, ticks64, delay/sleep and swtimer of lazurite_system.c on timer 0/1,
+// timer 6/7 and standby modes of the simulation.
+
+#define US(t)	((unsigned long)((t) / 512))
+
+static void test_boot(void)
+{
+	sim_boot();
+	CHECK(getMIE() == 1);
+	CHECK(millis() == US(sim_time) / 1000 || millis() + 1 == US(sim_time) / 1000);
+	printf("boot: %lu us\n", US(sim_time));
+}
+
+static void test_clock(void)
+{
+	SIM_TIME t;
+	unsigned long m, u;
+
+	sim_boot();
+	m = millis();
+	u = micros();
+	sim_clock_advance(1234567);
+	CHECK(millis() - m >= 1234 && millis() - m <= 1235);
+	CHECK(micros() - u >= 1234500 && micros() - u <= 1234600);
+
+	// delay() halts until timer 6/7, and the error is less than 2 ms
+	t = sim_time;
+	delay(100);
+	t = sim_time - t;
+	CHECK(t >= SIM_MS(100) && t < SIM_MS(102));
+	printf("delay(100): %lu us\n", US(t));
+
+	// delayMicroseconds() is a busy loop calibrated by LSCLK
+	t = sim_time;
+	delayMicroseconds(500);
+	t = sim_time - t;
+	CHECK(t >= SIM_US(450) && t < SIM_US(550));
+	printf("delayMicroseconds(500): %lu us\n", US(t));
+
+	// sleep() halts in the deepest mode allowed
+	t = sim_time;
+	sleep(250);
+	t = sim_time - t;
+	CHECK(t >= SIM_MS(250) && t < SIM_MS(252));
+	printf("sleep(250): %lu us, halt %lu / halt-h %lu / stop %lu\n", US(t),
+		sim_stat.halt[0], sim_stat.halt[1], sim_stat.halt[3]);
+}
+
+static SW_TIMER timer_a, timer_b;
+static unsigned long fired_a, fired_b;
+static unsigned long last_b;
+
+static void func_a(SW_TIMER *timer)
+{
+	fired_a++;
+}
+
+static void func_b(SW_TIMER *timer)
+{
+	fired_b++;
+	last_b = millis();
+}
+
+static void test_swtimer(void)
+{
+	unsigned long start;
+
+	sim_boot();
+	fired_a = fired_b = 0;
+	start = millis();
+	swtimer_start(&timer_a, 30, 0, func_a);
+	swtimer_start(&timer_b, 10, 10, func_b);
+	CHECK(swtimer_active(&timer_a) && swtimer_active(&timer_b));
+
+	// both timers share timer 6/7, and delay() runs on it as well
+	delay(95);
+	CHECK(fired_a == 1);
+	CHECK(!swtimer_active(&timer_a));
+	CHECK(fired_b == 9);
+	CHECK(last_b - start >= 89 && last_b - start <= 91);
+	swtimer_stop(&timer_b);
+	delay(50);
+	CHECK(fired_b == 9);
+}
+
+static void test_residency(void)
+{
+	LP_RESIDENCY res;
+
+	sim_boot();
+	lp_clrResidency();
+	sleep(100);
+	lp_getResidency(&res);
+	CHECK(res.count[LP_MODE_HALT] + res.count[LP_MODE_HALTH] + res.count[LP_MODE_STOP] > 0);
+	// ticks of LSCLK in standby covers most of the sleep
+	CHECK(res.ticks[LP_MODE_HALT] + res.ticks[LP_MODE_HALTH] + res.ticks[LP_MODE_STOP] >= 3200);
+	printf("sleep(100): halt %lu, halt-h %lu, stop %lu entries\n",
+		res.count[LP_MODE_HALT], res.count[LP_MODE_HALTH], res.count[LP_MODE_STOP]);
+}
+
+static unsigned long long ticks_value(void)
+{
+	TICKS64 t = ticks64();
+	return ((unsigned long long)t.high << 32) | t.low;
+}
+
+// overflow count h and counter l of timer 0/1 -> TICKS64
+static TICKS64 ticks_of(unsigned long h, unsigned short l)
+{
+	TICKS64 t;
+	t.high = (uint32_t)(h >> 16);
+	t.low = (uint32_t)((h << 16) | l);
+	return t;
+}
+
+// read hook of TM01C. the simulation runs to tm01c_preempt before the counter is
+// sampled, so that isr_sys_timer() interrupts ticks64() between the read of the
+// overflow count and the read of the counter.
+static SIM_TIME tm01c_preempt;
+static unsigned short tm01c_read(void)
+{
+	SIM_TIME t = tm01c_preempt;
+
+	tm01c_preempt = 0;
+	if(t > sim_time) sim_run(t - sim_time);
+	return TM01C;
+}
+
+// ticks64() around the overflow of timer 0/1 (every 2 sec). the overflow edge is
+// placed at each register access of ticks64() in turn, so that isr_sys_timer()
+// runs before, in the middle of and after the read.
+static void test_ticks64(void)
+{
+	SIM_TIME t_wrap;
+	unsigned long long base, w, v;
+	unsigned long n, before = 0, after = 0;
+	unsigned short k;
+
+	sim_boot();
+	while(TM01C != 0xFFFF) sim_step(1);
+	t_wrap = sim_time + SIM_LSCLK;			// next edge wraps the counter
+	base = ticks_value();
+	CHECK((base & 0xFFFF) == 0xFFFF);
+
+	for(k = 0, n = 1; k < 24; k++, n++)
+	{
+		w = base + 1 + (unsigned long long)n * 0x10000;
+		sim_run(t_wrap + (SIM_TIME)n * 0x10000 * SIM_LSCLK - (SIM_TIME)k * SIM_CYCLE - sim_time);
+		v = ticks_value();
+		CHECK(v == w - 1 || v == w);
+		if(v == w) after++;
+		else before++;
+		sim_clock_advance(100);
+		v = ticks_value();
+		CHECK(v >= w + 3 && v <= w + 4);
+	}
+	CHECK(before > 0 && after > 0);
+
+	// overflow interrupt between the overflow count and the counter. read is retried.
+	// the hook remains until sim_reset(), and it passes through while tm01c_preempt = 0.
+	sim_reg_hook(&TM01C, tm01c_read, NULL);
+	for(k = 0; k < 4; k++, n++)
+	{
+		w = base + 1 + (unsigned long long)n * 0x10000;
+		sim_run(t_wrap + (SIM_TIME)n * 0x10000 * SIM_LSCLK - SIM_CYCLE * 4 - sim_time);
+		tm01c_preempt = t_wrap + (SIM_TIME)n * 0x10000 * SIM_LSCLK + SIM_CYCLE;
+		v = ticks_value();
+		CHECK(v == w);
+	}
+
+	// overflow is pending in QTM1 while interrupts are disabled, and it is counted once
+	n++;
+	w = base + 1 + (unsigned long long)n * 0x10000;
+	sim_run(t_wrap + (SIM_TIME)n * 0x10000 * SIM_LSCLK - SIM_US(100) - sim_time);
+	noInterrupts();
+	sim_clock_advance(200);
+	v = ticks_value();
+	CHECK(v >= w + 3 && v <= w + 4);
+	interrupts();
+	CHECK(ticks_value() - v <= 1);
+	sim_clock_advance(1000);
+	CHECK(ticks_value() - w >= 35 && ticks_value() - w <= 37);
+	printf("ticks64 at overflow: %lu before, %lu after the edge\n", before, after);
+
+	// millis() wraps at 2^32 ms, micros() at 2^32 us, and low half of TICKS64 at 2^32 ticks
+	CHECK(ticks_to_ms(ticks_of(0x10000, 0)) - ticks_to_ms(ticks_of(0xFFFF, 0x8000)) == 1000);
+	CHECK(ticks_to_ms(ticks_of(2147484, 0)) - ticks_to_ms(ticks_of(2147483, 0)) == 2000);
+	CHECK(ticks_to_ms(ticks_of(2147484, 0)) < ticks_to_ms(ticks_of(2147483, 0)));
+	CHECK(ticks_to_us(ticks_of(2147, 0x8000)) - ticks_to_us(ticks_of(2147, 0)) == 1000000);
+	CHECK(ticks_to_us(ticks_of(2147, 0x8000)) < ticks_to_us(ticks_of(2147, 0)));
+}
+
+static EVENT_GROUP event;
+static SW_TIMER event_src;
+static void event_src_func(SW_TIMER *timer)
+{
+	event_set(&event, 0x04);
+}
+
+// the event is set by an interrupt which comes after the bits are checked and before
+// HALT. the request must release HALT, not be left to the next interrupt (2 sec).
+static void test_event(void)
+{
+	SIM_TIME t;
+	unsigned long start;
+
+	sim_boot();
+	sim_reg_hook(&TM01C, tm01c_read, NULL);
+	event.bits = 0;
+	swtimer_start(&event_src, 5, 0, event_src_func);
+	// the timer expires in 6-7 ms, while the simulation runs to 8 ms in the first
+	// read of TM01C, which is in lp_idle() before HALT
+	tm01c_preempt = sim_time + SIM_MS(8);
+	t = sim_time;
+	CHECK(wait_any(&event, 0x06, EVENT_WAIT_FOREVER) == 0x04);
+	CHECK(sim_time - t < SIM_MS(9));
+	CHECK(event.bits == 0);
+	printf("event before HALT: woke up after %llu us\n", (sim_time - t) / 512);
+
+	// timeout, and bits which are set remain for wait_all()
+	event_set(&event, 0x01);
+	start = millis();
+	CHECK(wait_all(&event, 0x03, 20) == 0x01);
+	CHECK(millis() - start >= 20 && millis() - start <= 22);
+	CHECK(event.bits == 0x01);
+	swtimer_start(&event_src, 5, 0, event_src_func);
+	CHECK(wait_any(&event, 0x04, 20) == 0x04);
+	CHECK(event.bits == 0x01);
+}
+
+int main(void)
+{
+	test_boot();
+	test_clock();
+	test_swtimer();
+	test_residency();
+	test_ticks64();
+	test_event();
+	return TEST_RESULT();
+}
@@ -0,0 +1,289 @@
+/* FILE NAME: test_tft.c
+ *
+ * Copyright (c) 2015  Lapis Semiconductor Co.,Ltd.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "common.h"
+#include "lazurite.h"
+#include "pin_assignment.h"
+#include "spi.h"
+#include "TFT.h"
+#include "driver_pin_assignment.h"
+#include "sim.h"
+#include "host_test.h"
+#include <string.h>
+
+// ST7735 on SIOF0. bytes on bus, command bytes and address windows (RAMWR) of text()
+// and drawChar() are counted, and pixels are written to a frame buffer so that
+// the glyph drawn by each path can be compared.
+// TFT.c drives CS and RS by PnD directly. CS and RS are read from the port in each
+// byte, and a select of the device is counted by SF0BRR: settings of the TFT are
+// applied by beginTransaction() and the default (DIV8) is restored by endTransaction().
+
+#define TFT_CS_PIN		10
+#define TFT_RS_PIN		9
+#define TFT_RST_PIN		8
+#define LCD_SIZE		160
+#define LCD_BLANK		0x1234			// pixel not written
+#define WHITE			0xFFFF			// same in the byte order of any panel
+#define BLACK			0x0000
+
+static unsigned short fb[LCD_SIZE][LCD_SIZE];
+static struct {
+	volatile unsigned char *cs_port, *rs_port;
+	unsigned char cs_bit, rs_bit;
+	unsigned char cmd;
+	unsigned char arg[4];
+	unsigned char narg;
+	unsigned char x0, x1, y0, y1;
+	unsigned short x, y;
+	unsigned char hi, half;
+} lcd;
+
+typedef struct {
+	unsigned long bytes;				// bytes on bus
+	unsigned long cmds;					// command bytes (RS = 0)
+	unsigned long windows;				// RAMWR
+	unsigned long selects;				// beginTransaction() with settings of TFT
+	unsigned long stray;				// bytes while CS is high
+} LCD_STAT;
+static LCD_STAT stat;
+
+static void lcd_pixel(unsigned char data)
+{
+	if(!lcd.half) {
+		lcd.hi = data;
+		lcd.half = 1;
+		return;
+	}
+	lcd.half = 0;
+	if((lcd.y > lcd.y1) || (lcd.x >= LCD_SIZE) || (lcd.y >= LCD_SIZE)) return;
+	fb[lcd.y][lcd.x] = (unsigned short)((lcd.hi << 8) | data);
+	if(++lcd.x > lcd.x1) {
+		lcd.x = lcd.x0;
+		lcd.y++;
+	}
+}
+
+static unsigned char lcd_exchange(unsigned char mosi)
+{
+	if(*lcd.cs_port & lcd.cs_bit) {
+		stat.stray++;
+		return 0xFF;
+	}
+	stat.bytes++;
+	if(!(*lcd.rs_port & lcd.rs_bit)) {
+		stat.cmds++;
+		lcd.cmd = mosi;
+		lcd.narg = 0;
+		if(mosi == ST7735_RAMWR) {
+			stat.windows++;
+			lcd.x = lcd.x0;
+			lcd.y = lcd.y0;
+			lcd.half = 0;
+		}
+		return 0x00;
+	}
+	switch(lcd.cmd)
+	{
+	case ST7735_CASET:
+	case ST7735_RASET:
+		if(lcd.narg < 4) lcd.arg[lcd.narg++] = mosi;
+		if(lcd.narg < 4) break;
+		if(lcd.cmd == ST7735_CASET) {
+			lcd.x0 = lcd.arg[1];
+			lcd.x1 = lcd.arg[3];
+		} else {
+			lcd.y0 = lcd.arg[1];
+			lcd.y1 = lcd.arg[3];
+		}
+		break;
+	case ST7735_RAMWR:
+		lcd_pixel(mosi);
+		break;
+	default:
+		break;
+	}
+	return 0x00;
+}
+
+static void lcd_brr_write(unsigned short data)
+{
+	if(data == SPI_CLOCK_DIV4) stat.selects++;
+}
+
+static void lcd_clear(void)
+{
+	unsigned short x, y;
+	for(y = 0; y < LCD_SIZE; y++)
+	{
+		for(x = 0; x < LCD_SIZE; x++) fb[y][x] = LCD_BLANK;
+	}
+	memset(&stat, 0, sizeof(stat));
+}
+
+static void lcd_begin(void)
+{
+	sim_boot();
+	memset(&lcd, 0, sizeof(lcd));
+	lcd.cs_port = (volatile unsigned char *)(long)ml620504f_pin_to_port[digital_pin_to_port[TFT_CS_PIN]];
+	lcd.cs_bit = ml620504f_pin_to_bit[digital_pin_to_port[TFT_CS_PIN]];
+	lcd.rs_port = (volatile unsigned char *)(long)ml620504f_pin_to_port[digital_pin_to_port[TFT_RS_PIN]];
+	lcd.rs_bit = ml620504f_pin_to_bit[digital_pin_to_port[TFT_RS_PIN]];
+	sim_spi_attach(lcd_exchange);
+	TFT(TFT_CS_PIN, TFT_RS_PIN, TFT_RST_PIN);
+	tft.begin();
+	SPI.setClockDivider(SPI_CLOCK_DIV8);
+	SPI.beginTransaction(NULL);			// DIV8 is applied to SIOF0
+	SPI.endTransaction();
+	sim_reg_hook(&SF0BRR, NULL, lcd_brr_write);
+	lcd_clear();
+}
+
+// pixels of color and horizontal runs of them in the rectangle
+static unsigned long lcd_count(int x, int y, int w, int h, unsigned short color, unsigned long *runs)
+{
+	unsigned long n = 0;
+	int i, j;
+
+	if(runs) *runs = 0;
+	for(j = y; j < y + h; j++)
+	{
+		for(i = x; i < x + w; i++)
+		{
+			if(fb[j][i] != color) continue;
+			n++;
+			if(runs && ((i == x) || (fb[j][i - 1] != color))) (*runs)++;
+		}
+	}
+	return n;
+}
+
+static void report(const char *name, unsigned long chars)
+{
+	printf("%-28s %5lu bytes %3lu windows %2lu selects %6.1f bytes/char\n", name,
+		stat.bytes, stat.windows, stat.selects, (double)stat.bytes / (double)chars);
+}
+
+// fillRect: one window of 11 bytes (CASET/RASET + 4, RAMWR) and 2 bytes per pixel
+static void test_fill(void)
+{
+	lcd_clear();
+	tft.fillRect(10, 20, 30, 4, WHITE);
+	CHECK(stat.selects == 1 && stat.windows == 1 && stat.cmds == 3);
+	CHECK(stat.bytes == 11 + 2 * 30 * 4);
+	CHECK(lcd_count(10, 20, 30, 4, WHITE, NULL) == 30 * 4);
+	CHECK(lcd_count(0, 0, LCD_SIZE, LCD_SIZE, WHITE, NULL) == 30 * 4);
+
+	// clipped at the left edge
+	lcd_clear();
+	tft.fillRect(-5, 0, 10, 2, WHITE);
+	CHECK(stat.windows == 1 && stat.bytes == 11 + 2 * 5 * 2);
+	CHECK(lcd_count(0, 0, 5, 2, WHITE, NULL) == 5 * 2);
+	CHECK(stat.stray == 0);
+}
+
+// opaque and fully visible glyph: one window of 6x8*size pixels
+static void test_opaque(void)
+{
+	lcd_clear();
+	tft.drawChar(0, 0, 'A', WHITE, BLACK, 1);
+	CHECK(stat.selects == 1 && stat.windows == 1);
+	CHECK(stat.bytes == 11 + 2 * 6 * 8);
+	CHECK(lcd_count(0, 0, 6, 8, WHITE, NULL) + lcd_count(0, 0, 6, 8, BLACK, NULL) == 6 * 8);
+	report("drawChar opaque size 1", 1);
+
+	lcd_clear();
+	tft.drawChar(0, 0, 'A', WHITE, BLACK, 2);
+	CHECK(stat.selects == 1 && stat.windows == 1);
+	CHECK(stat.bytes == 11 + 2 * 12 * 16);
+	report("drawChar opaque size 2", 1);
+	CHECK(stat.stray == 0);
+}
+
+// transparent glyph: one window per horizontal run of the glyph drawn by the opaque path
+static void test_transparent(void)
+{
+	static const char str[] = "Hello";
+	unsigned long pixels, runs, lit;
+	unsigned short i;
+
+	lcd_clear();
+	for(i = 0; i < 5; i++) tft.drawChar(i * 6, 0, str[i], WHITE, BLACK, 1);
+	pixels = lcd_count(0, 0, 30, 8, WHITE, &runs);
+	CHECK(stat.selects == 5 && stat.bytes == 5 * (11 + 2 * 6 * 8));
+	report("drawChar opaque x5", 5);
+
+	lcd_clear();
+	for(i = 0; i < 5; i++) tft.drawChar(i * 6, 0, str[i], WHITE, WHITE, 1);
+	CHECK(lcd_count(0, 0, 30, 8, WHITE, NULL) == pixels);
+	CHECK(lcd_count(0, 0, LCD_SIZE, LCD_SIZE, WHITE, NULL) == pixels);
+	CHECK(stat.windows == runs);
+	CHECK(stat.bytes == 11 * runs + 2 * pixels);
+	report("drawChar transparent x5", 5);
+
+	// text() draws with the stroke color and transparent background, under one select
+	lcd_clear();
+	tft.stroke(255, 255, 255);
+	tft.text(str, 0, 0);
+	lit = lcd_count(0, 0, 30, 8, WHITE, NULL);
+	CHECK(lit == pixels);
+	CHECK(stat.selects == 1);
+	CHECK(stat.windows == runs && stat.bytes == 11 * runs + 2 * pixels);
+	report("text \"Hello\"", 5);
+	CHECK(stat.stray == 0);
+}
+
+// clipped glyph: runs of both colors in the visible columns
+static void test_clipped(void)
+{
+	unsigned long fg, bg, fg_runs, bg_runs;
+
+	lcd_clear();
+	tft.drawChar(-2, 0, 'A', WHITE, BLACK, 1);
+	fg = lcd_count(0, 0, 4, 8, WHITE, &fg_runs);
+	bg = lcd_count(0, 0, 4, 8, BLACK, &bg_runs);
+	CHECK(fg + bg == 4 * 8);
+	CHECK(lcd_count(0, 0, LCD_SIZE, LCD_SIZE, LCD_BLANK, NULL) == LCD_SIZE * LCD_SIZE - 4 * 8);
+	CHECK(stat.selects == 1);
+	CHECK(stat.windows == fg_runs + bg_runs);
+	CHECK(stat.bytes == 11 * stat.windows + 2 * 4 * 8);
+	report("drawChar opaque clipped", 1);
+
+	// text at the bottom edge. 3 rows are visible
+	lcd_clear();
+	tft.stroke(255, 255, 255);
+	tft.text("Hello", 0, tft.height() - 3);
+	fg = lcd_count(0, tft.height() - 3, 30, 3, WHITE, &fg_runs);
+	CHECK(lcd_count(0, 0, LCD_SIZE, LCD_SIZE, WHITE, NULL) == fg);
+	CHECK(stat.selects == 1);
+	CHECK(stat.windows == fg_runs && stat.bytes == 11 * fg_runs + 2 * fg);
+	report("text \"Hello\" clipped", 5);
+	CHECK(stat.stray == 0);
+}
+
+int main(void)
+{
+	lcd_begin();
+	test_fill();
+	test_opaque();
+	test_transparent();
+	test_clipped();
+	return TEST_RESULT();
+}
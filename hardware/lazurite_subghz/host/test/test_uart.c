@@ -0,0 +1,235 @@
+/* FILE NAME: test_uart.c
+ *
+ * Copyright (c) 2015  Lapis Semiconductor Co.,Ltd.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "common.h"
+#include "mcu.h"
+#include "driver_irq.h"
+#include "driver_uart.h"
+#include "sim.h"
+#include "host_test.h"
+
+#define HW_FIFO_DEPTH		16					// depth of TX and RX FIFO of UARTF
+
+// model of UARTF hardware
+static unsigned char hw_tx[HW_FIFO_DEPTH];
+static unsigned char hw_tx_len;
+static unsigned char hw_tx_ovf;
+static unsigned char hw_rx[HW_FIFO_DEPTH];
+static unsigned char hw_rx_len;
+static unsigned char hw_rx_rd;
+
+// data sent to the line
+static unsigned char line[512];
+static unsigned short line_len;
+
+static void hw_uaf0buf_write(unsigned short data)
+{
+	if(UF0DLAB) return;							// divisor latch
+	if(hw_tx_len >= HW_FIFO_DEPTH)
+	{
+		hw_tx_ovf = 1;
+		return;
+	}
+	hw_tx[hw_tx_len++] = (unsigned char)data;
+}
+
+static unsigned short hw_uaf0buf_read(void)
+{
+	if(hw_rx_rd >= hw_rx_len) return 0;
+	return hw_rx[hw_rx_rd++];
+}
+
+static unsigned short hw_uaf0lsr_read(void)
+{
+	return (hw_rx_rd < hw_rx_len) ? 0x01 : 0x00;	// UF0DR
+}
+
+static void hw_begin(void)
+{
+	sim_reset();
+	hw_tx_len = 0;
+	hw_tx_ovf = 0;
+	hw_rx_len = 0;
+	hw_rx_rd = 0;
+	line_len = 0;
+	sim_reg_hook(&UAF0BUF, hw_uaf0buf_read, hw_uaf0buf_write);
+	sim_reg_hook(&UAF0LSR, hw_uaf0lsr_read, NULL);
+	uartf_begin(115200);
+}
+
+// send all data in hardware FIFO to the line and raise THRE interrupt
+// return = true when hardware FIFO was not empty
+static bool hw_tx_shift(void)
+{
+	unsigned char i;
+	if(hw_tx_len == 0) return false;
+	for(i = 0; i < hw_tx_len; i++)
+	{
+		if(line_len < sizeof(line)) line[line_len++] = hw_tx[i];
+	}
+	hw_tx_len = 0;
+	write_reg16(UAF0IIR, 1<<1);					// SEND
+	sim_irq_raise(IRQ_NO_UAF0INT);
+	return true;
+}
+
+// receive data from the line and raise receive interrupt
+static void hw_rx_line(const char* data, unsigned char len)
+{
+	memcpy(hw_rx, data, len);
+	hw_rx_len = len;
+	hw_rx_rd = 0;
+	write_reg16(UAF0IIR, 2<<1);					// READ
+	sim_irq_raise(IRQ_NO_UAF0INT);
+}
+
+static void test_fifo(void)
+{
+	UCHAR buf[4];
+	FIFO_CTRL fifo = { sizeof(buf), buf, 0, 0, 0 };
+	UCHAR *p;
+	size_t i;
+
+	uart_fifo_init(&fifo);
+	CHECK(uart_fifo_out(&fifo) == -1);
+	for(i = 0; i < 4; i++) CHECK(uart_fifo_in(&fifo, (UCHAR)('a'+i)) == 1);
+	CHECK(uart_fifo_in(&fifo, 'x') == 0);		// full
+	CHECK(uart_fifo_out(&fifo) == 'a');
+	CHECK(uart_fifo_out(&fifo) == 'b');
+	CHECK(uart_fifo_in(&fifo, 'e') == 1);		// wrapped
+	CHECK(uart_fifo_out_peek(&fifo) == 'c');
+
+	CHECK(uart_fifo_peek_span(&fifo, &p) == 2);	// up to the end of buffer
+	CHECK((p[0] == 'c') && (p[1] == 'd'));
+	uart_fifo_consume(&fifo, 2);
+	CHECK(uart_fifo_peek_span(&fifo, &p) == 1);
+	CHECK(p[0] == 'e');
+	uart_fifo_consume(&fifo, 5);				// limited to length
+	CHECK(fifo.length == 0);
+	CHECK(uart_fifo_out(&fifo) == -1);
+}
+
+static void test_uartf_tx(void)
+{
+	UART_STATS stats;
+	unsigned short i;
+
+	hw_begin();
+	for(i = 0; i < 100; i++) CHECK(uartf_tx_write((char)i) == 1);
+	CHECK(hw_tx_len == 1);						// first data is written before the rest is queued
+	while(hw_tx_shift()) {}
+	CHECK(hw_tx_ovf == 0);
+	CHECK(line_len == 100);
+	for(i = 0; i < line_len; i++)
+	{
+		if(line[i] != (unsigned char)i) break;
+	}
+	CHECK(i == 100);
+	uartf_get_stats(&stats);
+	CHECK(stats.tx_bytes == 100);
+}
+
+static bool async_done;
+static void on_async_done(void)
+{
+	async_done = true;
+}
+
+static void test_uartf_tx_async(void)
+{
+	static char data[40];
+	unsigned short i;
+
+	hw_begin();
+	for(i = 0; i < sizeof(data); i++) data[i] = (char)('0'+i);
+	async_done = false;
+	CHECK(uartf_tx_write_async(data, sizeof(data), on_async_done) == sizeof(data));
+	CHECK(hw_tx_len == HW_FIFO_DEPTH);
+	CHECK(uartf_tx_available() == 0);
+	CHECK(uartf_tx_write_async(data, sizeof(data), NULL) == 0);	// busy
+	while(hw_tx_shift()) {}
+	CHECK(hw_tx_ovf == 0);
+	CHECK(async_done == true);
+	CHECK(line_len == sizeof(data));
+	CHECK(memcmp(line, data, sizeof(data)) == 0);
+	CHECK(uartf_tx_available() == UARTF_TX_BUFFER_LENGTH);
+}
+
+// done chains next asynchronous write. done must be called only in interrupt,
+// and hardware FIFO must not be overfilled by the nested write.
+static char chain_data[5][6] = { "abcde", "fghij", "klmno", "pqrst", "uvwxy" };
+static unsigned char chain_n;
+static bool chain_outside_isr;
+static void on_chain_done(void)
+{
+	if(!sim_irq_in_isr()) chain_outside_isr = true;
+	if(++chain_n < 5) uartf_tx_write_async(chain_data[chain_n], 5, on_chain_done);
+}
+
+static void test_uartf_tx_async_chain(void)
+{
+	hw_begin();
+	chain_n = 0;
+	chain_outside_isr = false;
+	CHECK(uartf_tx_write_async(chain_data[0], 5, on_chain_done) == 5);
+	CHECK(chain_n == 0);						// not called by short data
+	while(hw_tx_shift()) {}
+	CHECK(chain_outside_isr == false);
+	CHECK(hw_tx_ovf == 0);
+	CHECK(chain_n == 5);
+	CHECK(line_len == 25);
+	CHECK(memcmp(line, "abcdefghijklmnopqrstuvwxy", 25) == 0);
+}
+
+static void test_uartf_rx(void)
+{
+	bool flag = false;
+	char *p;
+	size_t len;
+	UART_STATS stats;
+
+	hw_begin();
+	uartf_rx_set_delimiter('\n', &flag);
+	hw_rx_line("AT", 2);
+	CHECK(flag == false);
+	CHECK(uartf_rx_available() == 2);
+	hw_rx_line("+OK\n", 4);
+	CHECK(flag == true);
+	uartf_rx_peek_span(&p, &len);
+	CHECK(len == 6);
+	CHECK(memcmp(p, "AT+OK\n", 6) == 0);
+	uartf_rx_consume(len);
+	CHECK(uartf_rx_available() == 0);
+	uartf_get_stats(&stats);
+	CHECK(stats.rx_bytes == 6);
+	CHECK(stats.rx_peak == 6);
+	CHECK(stats.rx_overrun == 0);
+}
+
+int main(void)
+{
+	test_fifo();
+	test_uartf_tx();
+	test_uartf_tx_async();
+	test_uartf_tx_async_chain();
+	test_uartf_rx();
+	return TEST_RESULT();
+}
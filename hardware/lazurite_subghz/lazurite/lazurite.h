@@ -44,6 +44,7 @@ extern void loop(void);					// Arduino loop function
 #include "WMath.h"
 #include "flash.h"
 #include "tone.h"
+#include "swtimer.h"
 #include <stdlib.h>
 #include <math.h>
 
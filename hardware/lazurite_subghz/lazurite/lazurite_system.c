@@ -32,11 +32,13 @@
 #include "driver_timer.h"
 #include "driver_irq.h"
 #include "driver_i2c.h"
+#include "driver_ltbc.h"
 #include "driver_uart.h"
 #include "driver_gpio.h"
 #include "lp_manage.h"
 #include "clock.h"
 #include "rdwr_reg.h"
+#include "swtimer.h"
 
 //#define MIE_TEST
 //#define _DEBUG
@@ -48,16 +50,26 @@
 //********************************************************************************
 //   local definitions
 //********************************************************************************
+// delay_microseconds()
+// delays of DELAY_US_SHORT or longer wait on timer 0/1 (LSCLK), shorter ones
+// and the sub-tick remainder use a loop which is calibrated against LSCLK.
+#define DELAY_US_SHORT			64				// shorter delay uses the loop only
+#define DELAY_US_CHUNK			1000000UL		// keeps usec * DELAY_US_TO_TICK in 32bit
+#define DELAY_US_TO_TICK		2148			// 32768 / 1000000 in 1/65536 (rounded up)
+#define DELAY_CAL_LOOPS			8192			// loop count to measure loop cost
+#define DELAY_CAL_TICKS			16				// LSCLK ticks to measure poll cost
 
 //********************************************************************************
 //   local parameters
 //********************************************************************************
-static unsigned long sys_timer_count=0;
-
-static struct {
-	unsigned long target_h;
-	unsigned short target_l;
-} delay_time;
+static volatile unsigned long sys_timer_count=0;		// overflow count of timer 0/1 (every 2 sec)
+static SW_TIMER delay_timer;
+#ifdef SUBGHZ
+static bool subghz_vote = false;			// LP_NEED_HSCLK is voted for subghz_api_status
+#endif
+static unsigned short delay_loops_per_us = 256;		// delay_loop() per usec,       8bit fraction
+static unsigned short delay_loops_per_tick = 488;		// delay_loop() per LSCLK tick, 4bit fraction
+static unsigned short delay_polls_per_tick = 488;		// delay_wait_edge() polls per LSCLK tick, 4bit fraction
 //********************************************************************************
 //   local function definitions
 //********************************************************************************
@@ -66,10 +78,12 @@ static void clk_block_ctrl_init(void);
 void watch_dog_isr(void);
 static void lazurite_gpio_init(void);
 static void init_timer(void);
-static void delay_isr(void);
+static void delay_timer_func(SW_TIMER *timer);
 volatile bool delay_flag;
 static void start_long_timer(unsigned long ms);
 static void stop_long_timer(void);
+static void delay_calibrate(void);
+static void halt_wait(void);
 
 #ifdef LAZURITE_BLE
 	extern void ble_timer_func();
@@ -116,6 +130,9 @@ void init(void)
 	rst_interrupts();
 	__EI();
 
+	// LTBC0INT at 128Hz, which checks timeout of I2C
+	ltbc_init();
+
 	// Initializing GPIO
 	lazurite_gpio_init();
 	
@@ -148,9 +165,11 @@ void lazurite_gpio_init(void)
 	delay_flag = false;
 	timer_16bit_set(6,0xE8,(uint16_t)3,_ldo_stable_isr);
 	timer_16bit_start(6);
+	lp_addConstraint(LP_NEED_LSCLK);		// timer 6 runs on LSCLK
 	while(delay_flag == false) {
-		lp_setHaltMode();
+		lp_idle();
 	}
+	lp_removeConstraint(LP_NEED_LSCLK);
 
 	//digitalWrite(4,HIGH);
 
@@ -220,84 +239,43 @@ void HALT_Until_Event(HALT_EVENT halt_event,uint16_t timeout)
 				}
 				break;
 		}		
+		// I2C sequence is stopped by timeout of driver, so that CPU can halt until interrupt.
+		// status is checked again with interrupt disabled, because I2C interrupt may complete
+		// the sequence just before HALT. HALT is released by the enabled interrupt request
+		// even while MIE = 0, and the interrupt is executed after enb_interrupts.
+		if (cont && (timeout == 0) && (halt_event != HALT_DELAY) && (getMIE() != 0)) {
+			dis_interrupts(DI_I2C);
+			if(i2c_get_status((halt_event == HALT_I2C0_END) ? 0 : 1) > I2C_MODE_ERROR) {
+				lp_addConstraint(LP_NEED_HSCLK);		// I2C stops in HALT-H mode
+				lp_idle();
+				lp_removeConstraint(LP_NEED_HSCLK);
+			}
+			enb_interrupts(DI_I2C);
+		}
 	}
 	return;
 }
 
-void delay_isr(void)
+static void delay_timer_func(SW_TIMER *timer)
 {
 #ifdef MIE_TEST
 	noInterrupts();
 	interrupts();
 #endif
-
-	// check end of timer
-	if(delay_time.target_h == 0)
-	{
-		delay_flag = true;
-		return;
-	}
-
-	// decriment high part of timer
-	delay_time.target_h--;
-
-	// update timer data
-	if(delay_time.target_h == 0)
-	{
-		if((delay_time.target_l == 0) || (TM67C >= delay_time.target_l))
-		{
-			delay_flag = true;
-			return;
-		}
-		else
-		{
-			T6OST = 1;
-			TM67D = delay_time.target_l;
-
-			delay_time.target_l = 0;
-		}
-	}
-#ifdef _DEBUG
-	Serial.print("TimerH:");
-	Serial.print_long(delay_time.target_h,DEC);
-	Serial.print("\tTimerL:");
-	Serial.println_long(delay_time.target_l,DEC);
-#endif
+	delay_flag = true;
 	return;
 }
 
+// delay, sleep and wait_event_timeout share timer 6/7 with other users through swtimer
 static void start_long_timer(unsigned long ms)
 {
-	unsigned long tmp_target_l;
-
 	delay_flag = false;
-	tmp_target_l = ((ms % 64000)<<8)/250;
-	delay_time.target_l = (unsigned short)tmp_target_l;
-	delay_time.target_h = ms / 64000;
-
-#ifdef _DEBUG
-	Serial.print_long(delay_time.target_h,HEX);
-	Serial.print("\t");
-	Serial.println_long(delay_time.target_l,HEX);
-#endif
-
-	if(delay_time.target_h==0)
-	{
-		timer_16bit_set(6,0xE8,(unsigned short)tmp_target_l,delay_isr);
-		delay_time.target_l = 0;
-	}
-	else
-	{
-		timer_16bit_set(6,0x68,0xFFFF,delay_isr);
-	}
-
-	// setup timer
-	timer_16bit_start(6);
+	swtimer_start(&delay_timer, ms, 0, delay_timer_func);
 }
 
 static void stop_long_timer(void)
 {
-	timer_16bit_stop(6);
+	swtimer_stop(&delay_timer);
 }
 
 void delay_long(unsigned long ms)
@@ -315,7 +293,7 @@ void delay_long(unsigned long ms)
 	} else {
 		start_long_timer(ms);
 		while(delay_flag == false) {
-			lp_setHaltMode();
+			lp_idle();
 			wdt_clear();
 		}
 	}
@@ -339,19 +317,7 @@ void sleep_long(unsigned long ms) {
 		drv_digitalWrite(11,HIGH);		// PWR LED OFF
 #endif
 		while(delay_flag == false) {
-#ifdef SUBGHZ
-			if((uart_tx_sending == true) || (uartf_tx_sending == true) || (subghz_api_status != 0)) {
-				lp_setHaltMode();
-			} else {
-				lp_setHaltHMode();
-			}
-#else
-			if((uart_tx_sending == true) || (uartf_tx_sending == true)) {
-				lp_setHaltMode();
-			} else {
-				lp_setHaltHMode();
-			}
-#endif
+			halt_wait();
 		}
 		wdt_clear();
 		stop_long_timer();
@@ -362,32 +328,55 @@ void sleep_long(unsigned long ms) {
 	return;
 }
 
-volatile unsigned long millis(void)
+// Read timer 0/1 and its overflow count without disabling interrupts.
+// The read is repeated when isr_sys_timer() ran in the middle of it.
+// An overflow which is pending (QTM1 = 1, handler not executed yet because
+// interrupts are disabled or a handler is running) is added here.
+TICKS64 ticks64(void)
 {
-	unsigned long timer_l;
+	TICKS64 ticks;
 	unsigned long timer_h;
-	unsigned long result;
+	unsigned short timer_l;
+	unsigned char pending;
+
+	do {
+		timer_h = sys_timer_count;
+		timer_l = read_reg16(TM01C);
+		pending = QTM1;
+		if(pending) {
+			timer_l = read_reg16(TM01C);	// counter has wrapped, read it again
+		}
+	} while(timer_h != sys_timer_count);
 
-	//	__DI();
-	dis_interrupts(DI_MILLIS);
-	timer_l = read_reg16(TM01C);
-	timer_h = sys_timer_count;
+	if(pending) timer_h++;
 
-	if(QTM1 == 1)
-	{
-		timer_h++;
-		timer_l=0;
-	}
+	ticks.high = timer_h >> 16;
+	ticks.low = (timer_h << 16) | timer_l;
+
+	return ticks;
+}
 
-	//	__EI();
-	enb_interrupts(DI_MILLIS);
+// ticks64 -> msec. result wraps around at 2^32 like millis()
+uint32_t ticks_to_ms(TICKS64 ticks)
+{
+	uint32_t timer_h = (ticks.high << 16) | (ticks.low >> 16);
+	uint32_t timer_l = ticks.low & 0xFFFF;
 
-	timer_l = (timer_l * 1000) >> 15;
-	timer_h = timer_h * 2000;
+	return (timer_h * 2000) + ((timer_l * 1000) >> 15);
+}
 
-	result = timer_h + timer_l;
+// ticks64 -> usec. result wraps around at 2^32 like micros()
+uint32_t ticks_to_us(TICKS64 ticks)
+{
+	uint32_t timer_h = (ticks.high << 16) | (ticks.low >> 16);
+	uint32_t timer_l = ticks.low & 0xFFFF;
 
-	return result;
+	return (timer_h * 2000000) + ((timer_l * 15625) >> 9);
+}
+
+volatile unsigned long millis(void)
+{
+	return ticks_to_ms(ticks64());
 }
 
 static void (*millis_timer_func)(uint32_t sys_timer_count);
@@ -412,6 +401,8 @@ static void init_timer(void)
 	millis_timer_func=NULL;
 	timer_16bit_set(TM_MILLIS,0x40,0xFFFF,isr_sys_timer);
 	timer_16bit_start(TM_MILLIS);
+	lp_addConstraint(LP_NEED_LSCLK);		// timer 0/1 and 6/7 run on LSCLK. millis() never stops, so STOP is not used
+	delay_calibrate();
 	return;
 }
 
@@ -435,6 +426,21 @@ void watch_dog_isr(void)
 #endif
 }
 
+// HALT until the next interrupt in the deepest mode allowed by power constraints.
+// SubGHz API does not vote by itself, so its status is turned into a vote here.
+static void halt_wait(void)
+{
+#ifdef SUBGHZ
+	if((subghz_api_status != 0) != subghz_vote)
+	{
+		subghz_vote = !subghz_vote;
+		if(subghz_vote) lp_addConstraint(LP_NEED_HSCLK);
+		else lp_removeConstraint(LP_NEED_HSCLK);
+	}
+#endif
+	lp_idle();
+}
+
 void wait_event(bool *flag)
 {
 #ifdef PWR_LED
@@ -443,20 +449,8 @@ void wait_event(bool *flag)
 
 	while(*flag == false)
 	{
-#ifdef SUBGHZ
-		if((uart_tx_sending == true) || (uartf_tx_sending == true) || (subghz_api_status != 0))
-#else
-			if((uart_tx_sending == true) || (uartf_tx_sending == true))
-#endif
-			{
-				lp_setHaltMode();
-				wdt_clear();
-			}
-			else
-			{
-				lp_setHaltHMode();
-				wdt_clear();
-			}
+		halt_wait();
+		wdt_clear();
 	}
 	*flag = false;
 #ifdef PWR_LED
@@ -466,48 +460,106 @@ void wait_event(bool *flag)
 
 volatile unsigned long micros(void)
 {
-	unsigned long timer_l;
-	unsigned long timer_h;
-	unsigned long result;
+	return ticks_to_us(ticks64());
+}
+
+// busy loop of short delays. the cost of one loop is measured by delay_calibrate()
+static void delay_loop(unsigned short n)
+{
+	while(n > 0)
+	{
+		__asm("nop\n");
+		__asm("nop\n");
+		__asm("nop\n");
+		__asm("nop\n");
+		__asm("nop\n");
+		n--;
+	}
+}
 
-	//	__DI();
-	dis_interrupts(DI_MILLIS);
-	timer_l = read_reg16(TM01C);
-	timer_h = sys_timer_count;
+// wait for the next count of timer 0/1 and return number of polls
+static unsigned short delay_wait_edge(void)
+{
+	unsigned short start;
+	unsigned short polls = 0;
+
+	start = read_reg16(TM01C);
+	while(read_reg16(TM01C) == start)
+	{
+		polls++;
+	}
+	return polls;
+}
 
-	if(QTM1 == 1)
+//  measure cost of delay_loop() and delay_wait_edge() against LSCLK.
+//  called in init() while interrupts are disabled.
+static void delay_calibrate(void)
+{
+	unsigned short start;
+	unsigned short ticks;
+	unsigned short polls = 0;
+	unsigned char i;
+
+	delay_wait_edge();
+	start = read_reg16(TM01C);
+	delay_loop(DELAY_CAL_LOOPS);
+	ticks = read_reg16(TM01C) - start;
+	if(ticks == 0) return;
+
+	delay_loops_per_tick = (unsigned short)(((unsigned long)DELAY_CAL_LOOPS << 4) / ticks);
+	delay_loops_per_us = (unsigned short)(((unsigned long)delay_loops_per_tick << 13) / 15625);	// *16*32768/1000000
+
+	delay_wait_edge();
+	for(i = 0; i < DELAY_CAL_TICKS; i++)
 	{
-		timer_h++;
-		timer_l=0;
+		polls += delay_wait_edge();
 	}
+	if(polls == 0) polls = 1;
+	delay_polls_per_tick = (unsigned short)(((unsigned long)polls << 4) / DELAY_CAL_TICKS);
+
+	return;
+}
 
-	//	__EI();
-	enb_interrupts(DI_MILLIS);
+// wait on timer 0/1. the time up to the first count is measured by polling
+// and the remainder of the last tick is made by delay_loop().
+static void delay_ticks(unsigned long us)
+{
+	unsigned long target;			// 1/256 tick
+	unsigned long phase;			// 1/256 tick
+	unsigned short start;
+	unsigned short whole;
 
-	timer_l = (timer_l * 15625) >> 9;
-	timer_h = timer_h * 2000000;
+	target = (us * DELAY_US_TO_TICK) >> 8;
 
-	result = timer_h + timer_l;
+	phase = ((unsigned long)delay_wait_edge() << 12) / delay_polls_per_tick;
+	start = read_reg16(TM01C);
+	if(phase >= target) return;
+	target -= phase;
 
-	return result;
+	whole = (unsigned short)(target >> 8);
+	while((unsigned short)(read_reg16(TM01C) - start) < whole)
+	{
+	}
+	delay_loop((unsigned short)(((target & 0xFF) * delay_loops_per_tick) >> 12));
+
+	return;
 }
 
-// for quick access, API is not in use.
-// delay interval is trimmed by NOP operation
 volatile void delay_microseconds(unsigned long us)
 {
-	if(us >= 2)
+	while(us > DELAY_US_CHUNK)
+	{
+		delay_ticks(DELAY_US_CHUNK);
+		us -= DELAY_US_CHUNK;
+	}
+	if(us >= DELAY_US_SHORT)
+	{
+		delay_ticks(us);
+	}
+	else if(us >= 2)
 	{
 		us -= 1;
-		while(us > 0)
-		{
-			__asm("nop\n");
-			__asm("nop\n");
-			__asm("nop\n");
-			__asm("nop\n");
-			__asm("nop\n");
-			us--;
-		}
+		delay_loop((unsigned short)((us * delay_loops_per_us) >> 8));
 	}
 
 	return;
@@ -535,20 +587,8 @@ uint32_t wait_event_timeout(uint8_t *flag,uint32_t time)
 	result = millis();
 	while((*flag == false) && (delay_flag == false))
 	{
-#ifdef SUBGHZ
-		if((uart_tx_sending == true) || (uartf_tx_sending == true) || (subghz_api_status != 0))
-#else
-			if((uart_tx_sending == true) || (uartf_tx_sending == true))
-#endif
-			{
-				lp_setHaltMode();
-				wdt_clear();
-			}
-			else
-			{
-				lp_setHaltHMode();
-				wdt_clear();
-			}
+		halt_wait();
+		wdt_clear();
 	}
 	stop_long_timer();
 
@@ -566,16 +606,83 @@ uint32_t wait_event_timeout(uint8_t *flag,uint32_t time)
 
 	return result;
 }
+
+void event_set(EVENT_GROUP *event, uint16_t bits)
+{
+	dis_interrupts(DI_EVENT);
+	event->bits |= bits;
+	enb_interrupts(DI_EVENT);
+}
+
+void event_clear(EVENT_GROUP *event, uint16_t bits)
+{
+	dis_interrupts(DI_EVENT);
+	event->bits &= ~bits;
+	enb_interrupts(DI_EVENT);
+}
+
+//  HALT until any (all = false) or all (all = true) bits of mask are set,
+//  or timeout [ms] expires. timeout = EVENT_WAIT_FOREVER waits without timeout.
+//  bits which satisfied the condition are cleared.
+//  return: bits of mask which were set. (0 or partial bits in case of timeout)
+//  bits are checked with interrupts disabled, and an interrupt which sets them before
+//  HALT releases HALT by its request. the handler runs when interrupts are enabled.
+//  timer of timeout is local, so that nested waits do not share it.
+static uint16_t event_wait(EVENT_GROUP *event, uint16_t mask, uint32_t timeout, bool all)
+{
+	SW_TIMER timer;
+	uint16_t fired;
+	bool done;
+
+	if(timeout != EVENT_WAIT_FOREVER) {
+		swtimer_start(&timer, timeout, 0, NULL);
+	}
+
+#ifdef PWR_LED
+	drv_digitalWrite(11,HIGH);		// PWR LED OFF
+#endif
+	while(1)
+	{
+		dis_interrupts(DI_EVENT);
+		fired = event->bits & mask;
+		done = all ? (fired == mask) : (fired != 0);
+		if(done == true) {
+			event->bits &= ~fired;
+			break;
+		}
+		if((timeout != EVENT_WAIT_FOREVER) && (swtimer_active(&timer) == false)) break;
+		halt_wait();
+		enb_interrupts(DI_EVENT);
+		wdt_clear();
+	}
+	enb_interrupts(DI_EVENT);
+	if(timeout != EVENT_WAIT_FOREVER) {
+		swtimer_stop(&timer);
+	}
+
+#ifdef PWR_LED
+	drv_digitalWrite(11,LOW);		// PWR LED ON
+#endif
+
+	return fired;
+}
+
+uint16_t wait_any(EVENT_GROUP *event, uint16_t mask, uint32_t timeout)
+{
+	return event_wait(event, mask, timeout, false);
+}
+
+uint16_t wait_all(EVENT_GROUP *event, uint16_t mask, uint32_t timeout)
+{
+	return event_wait(event, mask, timeout, true);
+}
 void di_wait(void) {
 	if(getMIE() == 0) {
 		if(QTM1 == 1) {
+			QTM1 = 0;				// clear first, ticks64() must not see it as pending
 			isr_sys_timer();
-			QTM1 = 0;
-		}
-		if(QTM7 == 1) {
-			delay_isr();
-			QTM7 = 0;
 		}
+		swtimer_check_irq();
 		uart_check_irq();
 		if(QI2C0 == 1) {
 			i2c0_isr();
@@ -585,6 +692,7 @@ void di_wait(void) {
 			i2c1_isr();
 			QI2C1 = 0;
 		}
+		ltbc_check_irq();
 	}
 }
 void alert(char * msg) {
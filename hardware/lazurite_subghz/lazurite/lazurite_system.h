@@ -33,6 +33,21 @@ typedef enum {
 	HALT_DELAY
 } HALT_EVENT;
 
+// 64bit count of LSCLK (32768Hz) since init(), as two 32bit halves.
+// value = high * 2^32 + low
+#define TICKS_PER_SEC	32768UL
+typedef struct {
+	uint32_t high;
+	uint32_t low;
+} TICKS64;
+
+// event group. bits are set by event_set() (also from interrupt handlers)
+// and waited by wait_any() / wait_all().
+#define EVENT_WAIT_FOREVER	0
+typedef struct {
+	volatile uint16_t bits;
+} EVENT_GROUP;
+
 //********************************************************************************
 //   global parameters
 //********************************************************************************
@@ -52,11 +67,18 @@ extern void sleep_long(unsigned long ms);
 extern volatile void delay_microseconds(unsigned long us);
 extern volatile unsigned long millis(void);
 extern volatile unsigned long micros(void);
+extern TICKS64 ticks64(void);
+extern uint32_t ticks_to_ms(TICKS64 ticks);
+extern uint32_t ticks_to_us(TICKS64 ticks);
 extern void interrupts(void);
 extern void noInterrupts(void);
 extern void wait_event(bool *flag);
 extern bool wait_timeout(uint32_t time);
 extern uint32_t wait_event_timeout(bool *flag,uint32_t time);
+extern void event_set(EVENT_GROUP *event, uint16_t bits);
+extern void event_clear(EVENT_GROUP *event, uint16_t bits);
+extern uint16_t wait_any(EVENT_GROUP *event, uint16_t mask, uint32_t timeout);
+extern uint16_t wait_all(EVENT_GROUP *event, uint16_t mask, uint32_t timeout);
 extern void set_timer0_function(void (*func)(uint32_t sys_timer_count));
 extern int voltage_check_oneshot(uint8_t level);
 extern uint8_t voltage_check(uint8_t level);
@@ -30,19 +30,22 @@
 #include "string.h"
 #include "serial.h"
 
-void print_init(char* x, size_t size);
+void print_init(char* x, unsigned short size);
 int printBuf_ln(void);
-int printBuf(char* data);
+int printBuf(const char* data);
 int printBuf_l(long data, unsigned char base);
 int printBuf_d(double data, unsigned char digit);
 int printBuf_f(float data, unsigned char digit);
 int printBuf_status(void);
 int printBuf_len(void);
+int printBuf_ovf(void);
+int printBuf_fx(long data, unsigned char digit);
 
 
 static unsigned short print_buf_size = 0;
 static unsigned short print_buf_len = 0;
 static char* print_buf=NULL;
+static bool print_buf_ovf = false;
 
 const t_print Print =
 {
@@ -54,37 +57,54 @@ const t_print Print =
 	printBuf_ln,
 	printBuf_status,
 	printBuf_len,
+	printBuf_ovf,
+	printBuf_fx,
 };
 
-void print_init(char* x, size_t size)
+void print_init(char* x, unsigned short size)
 {
 	
 	print_buf_size = size-1;
 	print_buf_len = 0;
+	print_buf_ovf = false;
 	print_buf = x;
 	if((print_buf_size == 0) || (print_buf == NULL)) return;
-	*print_buf = NULL;
+	*print_buf = '\0';
 }
 
 int printBuf_ln(void)
 {
 	static const char s[] = "\n";
 
-	if((print_buf_size == 0) || (print_buf == NULL)) return;
+	if((print_buf_size == 0) || (print_buf == NULL)) return 0;
 	
 	if(print_buf_size <= print_buf_len)
 	{
-		*(print_buf + print_buf_size - 1) = NULL;
+		*(print_buf + print_buf_size - 1) = '\0';
 		print_buf_len--;
 	}
 	return printBuf(s);
 }
 
-int printBuf(char* data)
+int printBuf(const char* data)
 {
-	if((print_buf_size == 0) || (print_buf == NULL)) return;
+	char *p;
+
+	if((print_buf_size == 0) || (print_buf == NULL)) return 0;
 
-	print_buf_len = strlen(strncat(print_buf,data,print_buf_size-print_buf_len));
+	// append from current write position. buffer is not scanned again.
+	p = print_buf + print_buf_len;
+	while(*data != '\0')
+	{
+		if(print_buf_len >= print_buf_size)
+		{
+			print_buf_ovf = true;				// data is truncated
+			break;
+		}
+		*p++ = *data++;
+		print_buf_len++;
+	}
+	*p = '\0';
 	
 	return print_buf_size-print_buf_len;
 }
@@ -110,6 +130,13 @@ int printBuf_f(float data, unsigned char digit)
 	return printBuf(buf);
 }
 
+int printBuf_fx(long data, unsigned char digit)
+{
+	char buf[33];
+	printFixed(buf,data,digit);
+	return printBuf(buf);
+}
+
 int printBuf_status(void){
 	if(print_buf == NULL) return -1;
 	
@@ -121,11 +148,92 @@ int printBuf_len(void)
 	return print_buf_len;
 }
 
+// return 1 when data was truncated after init
+int printBuf_ovf(void)
+{
+	return print_buf_ovf ? 1 : 0;
+}
+
+// 2 digits table for decimal conversion
+static const char print_dec2[] =
+	"00010203040506070809"
+	"10111213141516171819"
+	"20212223242526272829"
+	"30313233343536373839"
+	"40414243444546474849"
+	"50515253545556575859"
+	"60616263646566676869"
+	"70717273747576777879"
+	"80818283848586878889"
+	"90919293949596979899";
+
+static const unsigned long print_pow10[PRINT_MAX_DIGIT+1] = {
+	1UL, 10UL, 100UL, 1000UL, 10000UL,
+	100000UL, 1000000UL, 10000000UL, 100000000UL, 1000000000UL
+};
+
+// convert unsigned data to decimal charactor
+// char *x = pointer of charactor data
+// unsigned long n = data to be converted
+// unsigned char width = minimum number of digit. upper digits are filled by '0'
+// size_t retun value = length of charactor
+static size_t print_udec(char* x, unsigned long n, unsigned char width)
+{
+	char buf[12];
+	unsigned char i = sizeof(buf);
+	unsigned long m;
+	unsigned short s;
+	unsigned short q;
+	unsigned short r;
+
+	// 32bit division is used only while upper word is not 0
+	while(n > 0xFFFF)
+	{
+		m = n / 100;
+		s = (unsigned short)(n - m * 100) << 1;
+		n = m;
+		buf[--i] = print_dec2[s+1];
+		buf[--i] = print_dec2[s];
+	}
+
+	// remaining part is processed by 16bit division
+	s = (unsigned short)n;
+	while(s >= 100)
+	{
+		q = s / 100;
+		r = (unsigned short)(s - q * 100) << 1;
+		s = q;
+		buf[--i] = print_dec2[r+1];
+		buf[--i] = print_dec2[r];
+	}
+	if(s >= 10)
+	{
+		s <<= 1;
+		buf[--i] = print_dec2[s+1];
+		buf[--i] = print_dec2[s];
+	}
+	else
+	{
+		buf[--i] = (char)(s + '0');
+	}
+
+	if(width > sizeof(buf)) width = sizeof(buf);
+	while((unsigned char)(sizeof(buf) - i) < width)
+	{
+		buf[--i] = '0';
+	}
+
+	s = sizeof(buf) - i;
+	memcpy(x,&buf[i],s);
+	x[s] = '\0';						// add NULL code
+	return s;
+}
+
 size_t printNumber(char * x, long data, unsigned char base)
 {
 	char buf[33];					// buffer for charactor  size = 4byte long + NULL code
  	unsigned char digit = 0;		// number of digit
-	char sign = 0;					// sign
+	unsigned char shift = 0;		// shift for base of power of 2
 	unsigned long n;
 	unsigned long m;
     char c;
@@ -133,32 +241,54 @@ size_t printNumber(char * x, long data, unsigned char base)
 	if (base < 2) base = 10;			// if base is wrong, it is fixed to DEC
 	n = (unsigned long)data;
 
-	if((base == DEC) && (data < 0))		// process for minus
+	if(base == DEC)
 	{
-		sign = 1;						// stack sign bit
-		n = ~n;							// convert to absolute value
-		n += 1;							// convert to absolute value
+		i = 0;
+		if(data < 0)					// process for minus
+		{
+			x[i++] = '-';				// generate sign
+			n = ~n;						// convert to absolute value
+			n += 1;						// convert to absolute value
+		}
+		return i + print_udec(x+i,n,1);
+	}
+
+	switch(base)
+	{
+	case BIN:
+		shift = 1;
+		break;
+	case OCT:
+		shift = 3;
+		break;
+	case HEX:
+		shift = 4;
+		break;
+	default:
+		break;
 	}
 
 	do {								// convert data to character from 1st digit
-		m = n;
-		n /= base;
-		c = (char)(m - base * n);
+		if(shift)
+		{
+			c = (char)(n & (base - 1));
+			n >>= shift;
+		}
+		else
+		{
+			m = n;
+			n /= base;
+			c = (char)(m - base * n);
+		}
 		buf[digit] = (char)(c < 10 ? c + '0' : c + 'A' - 10);
 		digit++;
 	} while(n);
 	
-	if((base == DEC) && (sign == 1))	// generate sign
-	{
-		buf[digit] = '-';
-		digit++;
-	}
-	
 	for(i=0;i<(size_t)digit;i++)				// reverse charactor
 	{
 		x[i] = buf[digit-i-1];
 	}
-	x[i] = NULL;						// add NULL code
+	x[i] = '\0';						// add NULL code
 	return i;
 }
 
@@ -166,13 +296,13 @@ size_t printNumber(char * x, long data, unsigned char base)
 // char *x = pointer of charactor data
 // float data = data to be converted
 // unsigned char digit = fractional point of 4 down, 5 up round process
+//                       maximum is PRINT_MAX_DIGIT
 // size_t retun value = length of charactor
 size_t printFloat(char* x, double data, unsigned char digit)
 {
-	long m;
-	double round;
+	unsigned long m;					// unsigned, carry from 2147483647 does not overflow
+	unsigned long f;
 	size_t n = 0;
-	unsigned char i;
 	static const char s[] = "ovf";
 
 	// check overflow
@@ -181,6 +311,7 @@ size_t printFloat(char* x, double data, unsigned char digit)
 		strcpy(x,s);
 		return sizeof(s);
 	}
+	if(digit > PRINT_MAX_DIGIT) digit = PRINT_MAX_DIGIT;
 	
 	// convert to absolute value
 	if(data < 0)
@@ -188,19 +319,20 @@ size_t printFloat(char* x, double data, unsigned char digit)
 		data *= -1;
 		x[n++] = '-';
 	}
-	// round up & down process
-	round = 0.5;
-	for(i=0;i<digit;++i)
+	// separate integer part. subtraction of integer part has no rounding error.
+	m = (unsigned long)data;
+	data -= m;
+	
+	// fractional part is scaled to integer and rounded by 4 down, 5 up
+	f = (unsigned long)(data * (double)print_pow10[digit] + 0.5);
+	if(f >= print_pow10[digit])			// carry to integer part
 	{
-		round /= 10;
+		f -= print_pow10[digit];
+		m++;
 	}
-	data += round;
-	
-	// convert to integer
-	m=(long)data;						// convert integer
 	
 	// printing integer part
-	n += printNumber(x+n,m,DEC);		// convert integer part to charactor
+	n += print_udec(x+n,m,1);			// convert integer part to charactor
 	
 	if(digit == 0) return n;			// in case of integer
 	
@@ -208,25 +340,40 @@ size_t printFloat(char* x, double data, unsigned char digit)
 	x[n++] = '.';
 	
 	// print fractional part
-	data -= m;
-	for(i=0;i<digit;i++)
-	{
-		data *= 10;
-		m = (long)data;
-		if(m==0)
-		{
-			x[n++] = '0';
-		}
-	}
+	n += print_udec(x+n,f,digit);
+	
+	return n;
+}
+
+// convert fixed point data to charactor without floating point operation
+// char *x = pointer of charactor data
+// long data = data multiplied by 10^digit.  ex) data = -12345, digit = 2 --> "-123.45"
+// unsigned char digit = number of fractional digit. maximum is PRINT_MAX_DIGIT
+// size_t retun value = length of charactor
+size_t printFixed(char* x, long data, unsigned char digit)
+{
+	unsigned long n;
+	unsigned long m;
+	size_t len = 0;
 
-	if( m != 0 )
+	if(digit > PRINT_MAX_DIGIT) digit = PRINT_MAX_DIGIT;
+
+	n = (unsigned long)data;
+	if(data < 0)
 	{
-		 n += printNumber(x+n,m,DEC);
+		x[len++] = '-';
+		n = ~n;							// convert to absolute value
+		n += 1;
 	}
-	else
+	if(digit == 0)
 	{
-		x[n++] = NULL;
+		return len + print_udec(x+len,n,1);
 	}
-	
-	return n;
+
+	m = n / print_pow10[digit];
+	len += print_udec(x+len,m,1);		// integer part
+	x[len++] = '.';
+	len += print_udec(x+len,n - m * print_pow10[digit],digit);	// fractional part
+
+	return len;
 }
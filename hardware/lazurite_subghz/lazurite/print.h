@@ -25,20 +25,25 @@
 #include "lazurite.h"
 #include "mcu.h"
 
+#define PRINT_MAX_DIGIT		9		// maximum fractional digit of printFloat and printFixed
+
 typedef struct {
 	void (*init)(char* buf, unsigned short size);
-	int (*p)(char* data);
+	int (*p)(const char* data);
 	int (*l)(long data, unsigned char base);
 	int (*f)(float data, unsigned char digit);
 	int (*d)(double data, unsigned char digit);
 	int (*ln)(void);
 	int (*status)(void);
 	int (*len)(void);
+	int (*ovf)(void);
+	int (*fx)(long data, unsigned char digit);
 } t_print;
 
 extern const t_print Print;
 
 extern size_t printFloat(char* x, double data, unsigned char digit);
 extern size_t printNumber(char * x, long data, unsigned char base);
+extern size_t printFixed(char* x, long data, unsigned char digit);
 
 #endif
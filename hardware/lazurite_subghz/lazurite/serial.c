@@ -51,33 +51,37 @@ static const char crlf[] = "\r\n";
 //********************************************************************************
 //   local function definitions
 //********************************************************************************
-static void _hardware_serial11_begin(unsigned long baud);
+static void _hardware_serial11_begin(UINT32 baud);
 static void _hardware_serial11_end(void);
-static void _hardware_serial12_begin(unsigned long baud);
+static void _hardware_serial12_begin(UINT32 baud);
 static void _hardware_serial12_end(void);
-static void _hardware_serial13_begin(unsigned long baud);
+static void _hardware_serial13_begin(UINT32 baud);
 static void _hardware_serial13_end(void);
-static void _hardware_serial_print(char* data);
-static void _hardware_serial_println(char* data);
-static void _hardware_serial_print_long(long data, UCHAR fmt);
-static void _hardware_serial_println_long(long data, UCHAR fmt);
-static void _hardware_serial_print_double(double data, UCHAR digit);
-static void _hardware_serial_println_double(double data, UCHAR digit);
+static size_t _hardware_serial_print(const char* data);
+static size_t _hardware_serial_println(const char* data);
+static size_t _hardware_serial_print_long(long data, UCHAR fmt);
+static size_t _hardware_serial_println_long(long data, UCHAR fmt);
+static size_t _hardware_serial_print_double(double data, UCHAR digit);
+static size_t _hardware_serial_println_double(double data, UCHAR digit);
 static size_t _hardware_serial_tx_write(char* data, size_t quantity);
+static size_t _hardware_serial_print_fixed(long data, UCHAR digit);
+static size_t _hardware_serial_println_fixed(long data, UCHAR digit);
 
-static void _hardware_serial21_begin(unsigned long baud);
-static void _hardware_serial22_begin(unsigned long baud);
-static void _hardware_serial23_begin(unsigned long baud);
+static void _hardware_serial21_begin(UINT32 baud);
+static void _hardware_serial22_begin(UINT32 baud);
+static void _hardware_serial23_begin(UINT32 baud);
 static void _hardware_serial21_end(void);
 static void _hardware_serial22_end(void);
 static void _hardware_serial23_end(void);
-static void _hardware_serial2_print(char* data);
-static void _hardware_serial2_println(char* data);
-static void _hardware_serial2_print_long(long data, UCHAR fmt);
-static void _hardware_serial2_println_long(long data, UCHAR fmt);
-static void _hardware_serial2_print_double(double data, UCHAR digit);
-static void _hardware_serial2_println_double(double data, UCHAR digit);
+static size_t _hardware_serial2_print(const char* data);
+static size_t _hardware_serial2_println(const char* data);
+static size_t _hardware_serial2_print_long(long data, UCHAR fmt);
+static size_t _hardware_serial2_println_long(long data, UCHAR fmt);
+static size_t _hardware_serial2_print_double(double data, UCHAR digit);
+static size_t _hardware_serial2_println_double(double data, UCHAR digit);
 static size_t _hardware_serial2_tx_write(char* data, size_t quantity);
+static size_t _hardware_serial2_print_fixed(long data, UCHAR digit);
+static size_t _hardware_serial2_println_fixed(long data, UCHAR digit);
 
 const HardwareSerial Serial = {
 	_hardware_serial12_begin,
@@ -94,7 +98,14 @@ const HardwareSerial Serial = {
 	_hardware_serial_println_double,
 	_hardware_serial_tx_write,
 	uart_tx_write,
-	uart_tx_available
+	uart_tx_available,
+	_hardware_serial_print_fixed,
+	_hardware_serial_println_fixed,
+	uart_tx_write_async,
+	uart_rx_peek_span,
+	uart_rx_consume,
+	uart_rx_set_delimiter,
+	uart_get_stats
 };
 const HardwareSerial Serial1 = {
 	_hardware_serial21_begin,
@@ -111,7 +122,14 @@ const HardwareSerial Serial1 = {
 	_hardware_serial2_println_double,
 	_hardware_serial2_tx_write,
 	uartf_tx_write,
-	uartf_tx_available
+	uartf_tx_available,
+	_hardware_serial2_print_fixed,
+	_hardware_serial2_println_fixed,
+	uartf_tx_write_async,
+	uartf_rx_peek_span,
+	uartf_rx_consume,
+	uartf_rx_set_delimiter,
+	uartf_get_stats
 };
 const HardwareSerial Serial2 = {
 	_hardware_serial22_begin,
@@ -128,7 +146,14 @@ const HardwareSerial Serial2 = {
 	_hardware_serial2_println_double,
 	_hardware_serial2_tx_write,
 	uartf_tx_write,
-	uartf_tx_available
+	uartf_tx_available,
+	_hardware_serial2_print_fixed,
+	_hardware_serial2_println_fixed,
+	uartf_tx_write_async,
+	uartf_rx_peek_span,
+	uartf_rx_consume,
+	uartf_rx_set_delimiter,
+	uartf_get_stats
 };
 const HardwareSerial Serial3 = {
 	_hardware_serial23_begin,
@@ -145,7 +170,14 @@ const HardwareSerial Serial3 = {
 	_hardware_serial2_println_double,
 	_hardware_serial2_tx_write,
 	uartf_tx_write,
-	uartf_tx_available
+	uartf_tx_available,
+	_hardware_serial2_print_fixed,
+	_hardware_serial2_println_fixed,
+	uartf_tx_write_async,
+	uartf_rx_peek_span,
+	uartf_rx_consume,
+	uartf_rx_set_delimiter,
+	uartf_get_stats
 };
 
 // local function
@@ -153,7 +185,7 @@ const HardwareSerial Serial3 = {
 //********************************************************************************
 //   local functions
 //********************************************************************************
-void _hardware_serial11_begin(unsigned long baud)
+void _hardware_serial11_begin(UINT32 baud)
 {
 	uart_gpio_init(0);
 	uart_begin(baud,NULL,NULL);
@@ -163,7 +195,7 @@ void _hardware_serial11_end(void)
 	uart_gpio_end(0);
 	uart_end();
 }
-void _hardware_serial12_begin(unsigned long baud)
+void _hardware_serial12_begin(UINT32 baud)
 {
 	uart_gpio_init(1);
 	uart_begin(baud,NULL,NULL);
@@ -173,7 +205,7 @@ void _hardware_serial12_end(void)
 	uart_gpio_end(1);
 	uart_end();
 }
-void _hardware_serial13_begin(unsigned long baud)
+void _hardware_serial13_begin(UINT32 baud)
 {
 	uart_gpio_init(2);
 	uart_begin(baud,NULL,NULL);
@@ -184,17 +216,17 @@ void _hardware_serial13_end(void)
 	uart_end();
 }
 
-void _hardware_serial21_begin(unsigned long baud)
+void _hardware_serial21_begin(UINT32 baud)
 {
 	uart_gpio_init(3);
 	uartf_begin(baud);
 }
-void _hardware_serial22_begin(unsigned long baud)
+void _hardware_serial22_begin(UINT32 baud)
 {
 	uart_gpio_init(4);
 	uartf_begin(baud);
 }
-void _hardware_serial23_begin(unsigned long baud)
+void _hardware_serial23_begin(UINT32 baud)
 {
 	uart_gpio_init(5);
 	uartf_begin(baud);
@@ -250,55 +282,53 @@ size_t _hardware_serial2_tx_write(char* data, size_t quantity)
 }
 
 // print long data attaching CR and LF.
-void _hardware_serial_println_long(long data, UCHAR fmt)
+size_t _hardware_serial_println_long(long data, UCHAR fmt)
 {
 	char tmp_c[33];							// 33 is maximum length of charactor
 	printNumber(tmp_c, data,fmt);			// convert long data to charactor
-	_hardware_serial_println(tmp_c);		// send data though uart
-	return;
+	return _hardware_serial_println(tmp_c);		// send data though uart
 }
 
-void _hardware_serial2_println_long(long data, UCHAR fmt)
+size_t _hardware_serial2_println_long(long data, UCHAR fmt)
 {
 	char tmp_c[33];							// 33 is maximum length of charactor
 	printNumber(tmp_c, data,fmt);			// convert long data to charactor
-	_hardware_serial2_println(tmp_c);		// send data though uart
-	return;
+	return _hardware_serial2_println(tmp_c);		// send data though uart
 }
 
 // print long data without CR and LF.
-void _hardware_serial_print_long(long data, UCHAR fmt)
+size_t _hardware_serial_print_long(long data, UCHAR fmt)
 {
 	char tmp_c[33];
 	printNumber(tmp_c,data,fmt);
-	_hardware_serial_print(tmp_c);
+	return _hardware_serial_print(tmp_c);
 }
 
-void _hardware_serial2_print_long(long data, UCHAR fmt)
+size_t _hardware_serial2_print_long(long data, UCHAR fmt)
 {
 	char tmp_c[33];
 	printNumber(tmp_c,data,fmt);
-	_hardware_serial2_print(tmp_c);
+	return _hardware_serial2_print(tmp_c);
 }
 
 
 
 // print float data attaching CR and LF.
-void _hardware_serial_println_double(double data, UCHAR digit)
+size_t _hardware_serial_println_double(double data, UCHAR digit)
 {
 	char tmp_c[33];
 	printFloat(tmp_c, data,digit);
-	_hardware_serial_println(tmp_c);
+	return _hardware_serial_println(tmp_c);
 }
-void _hardware_serial2_println_double(double data, UCHAR digit)
+size_t _hardware_serial2_println_double(double data, UCHAR digit)
 {
 	char tmp_c[33];
 	printFloat(tmp_c, data,digit);
-	_hardware_serial2_println(tmp_c);
+	return _hardware_serial2_println(tmp_c);
 }
 
 // print float data without CR and LF.
-void _hardware_serial_print_double(double data, UCHAR digit)
+size_t _hardware_serial_print_double(double data, UCHAR digit)
 {
 	char tmp_c[33];
 //	unsigned char n;
@@ -307,9 +337,9 @@ void _hardware_serial_print_double(double data, UCHAR digit)
 //	{
 //		if(tmp_c[n] == NULL) break;
 //	}
-	_hardware_serial_print(tmp_c);
+	return _hardware_serial_print(tmp_c);
 }
-void _hardware_serial2_print_double(double data, UCHAR digit)
+size_t _hardware_serial2_print_double(double data, UCHAR digit)
 {
 	char tmp_c[33];
 //	unsigned char n;
@@ -318,15 +348,44 @@ void _hardware_serial2_print_double(double data, UCHAR digit)
 //	{
 //		if(tmp_c[n] == NULL) break;
 //	}
-	_hardware_serial2_print(tmp_c);
+	return _hardware_serial2_print(tmp_c);
+}
+
+// print fixed point data attaching CR and LF.
+// long data = data multiplied by 10^digit
+size_t _hardware_serial_println_fixed(long data, UCHAR digit)
+{
+	char tmp_c[33];
+	printFixed(tmp_c,data,digit);
+	return _hardware_serial_println(tmp_c);
+}
+size_t _hardware_serial2_println_fixed(long data, UCHAR digit)
+{
+	char tmp_c[33];
+	printFixed(tmp_c,data,digit);
+	return _hardware_serial2_println(tmp_c);
+}
+
+// print fixed point data without CR and LF.
+size_t _hardware_serial_print_fixed(long data, UCHAR digit)
+{
+	char tmp_c[33];
+	printFixed(tmp_c,data,digit);
+	return _hardware_serial_print(tmp_c);
+}
+size_t _hardware_serial2_print_fixed(long data, UCHAR digit)
+{
+	char tmp_c[33];
+	printFixed(tmp_c,data,digit);
+	return _hardware_serial2_print(tmp_c);
 }
 
 // print data without CR and LF.
-void _hardware_serial_print(char* data)
+size_t _hardware_serial_print(const char* data)
 {
 	int n = 0;
 	if(data != NULL) {
-		while(data[n] != NULL)
+		while(data[n] != '\0')
 		{
 			if(uart_tx_write(data[n]) == 1)
 			{
@@ -335,20 +394,20 @@ void _hardware_serial_print(char* data)
 				if(getMIE() == 0) {
 					di_wait();
 				} else {
-					lp_setHaltMode();
+					lp_idle();
 				}
 			}
 		}
 	}
-	return;
+	return n;
 }
 
-void _hardware_serial2_print(char* data)
+size_t _hardware_serial2_print(const char* data)
 {
 	int n = 0;
 
 	if(data != NULL) {
-		while(data[n] != NULL)
+		while(data[n] != '\0')
 		{
 			if(uartf_tx_write(data[n]) == 1)
 			{
@@ -357,23 +416,23 @@ void _hardware_serial2_print(char* data)
 				if(getMIE() == 0) {
 					di_wait();
 				} else {
-					lp_setHaltMode();
+					lp_idle();
 				}
 			}
 		}
 	}
-	return;
+	return n;
 }
 
 // print data with CR and LF.
-void _hardware_serial_println(char* data)
+size_t _hardware_serial_println(const char* data)
 {
-	_hardware_serial_print(data);
-	_hardware_serial_print(crlf);
+	size_t n = _hardware_serial_print(data);
+	return n + _hardware_serial_print(crlf);
 }
-void _hardware_serial2_println(char* data)
+size_t _hardware_serial2_println(const char* data)
 {
-	_hardware_serial2_print(data);
-	_hardware_serial2_print(crlf);
+	size_t n = _hardware_serial2_print(data);
+	return n + _hardware_serial2_print(crlf);
 }
 
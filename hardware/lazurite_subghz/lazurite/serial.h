@@ -25,6 +25,7 @@
 #include "common.h"
 #include "lazurite.h"
 #include "mcu.h"
+#include "driver_uart.h"
 
 
 //********************************************************************************
@@ -48,8 +49,8 @@ typedef struct {
 	int (*read)(void);
 	int (*peek)(void);
 	void (*flush)(void);
-	volatile size_t (*print)(char* data);
-	volatile size_t (*println)(char* data);
+	volatile size_t (*print)(const char* data);
+	volatile size_t (*println)(const char* data);
 	volatile size_t (*print_long)(long data, UCHAR fmt);
 	volatile size_t (*println_long)(long data, UCHAR fmt);
 	volatile size_t (*print_double)(double data, UCHAR digit);
@@ -57,6 +58,13 @@ typedef struct {
 	volatile size_t (*write)(char* data, size_t quantity);
 	volatile size_t (*write_byte)(char data);
 	int (*tx_available)(void);								// add 
+	volatile size_t (*print_fixed)(long data, UCHAR digit);
+	volatile size_t (*println_fixed)(long data, UCHAR digit);
+	volatile size_t (*write_async)(char* data, size_t quantity, void (*done)(void));
+	void (*rx_peek_span)(char** ptr, size_t* len);
+	void (*rx_consume)(size_t n);
+	void (*set_delimiter)(int delim, bool *flag);
+	void (*getStats)(UART_STATS* stats);
 } HardwareSerial;
 
 extern const HardwareSerial Serial;
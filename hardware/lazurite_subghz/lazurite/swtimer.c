@@ -0,0 +1,186 @@
+/* FILE NAME: swtimer.c
+ *
+ * Copyright (c) 2015  Lapis Semiconductor Co.,Ltd.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+#ifdef SUBGHZ_OTA
+	#pragma SEGCODE "OTA_SEGCODE"
+	#pragma SEGINIT "OTA_SEGINIT"
+	#pragma SEGNOINIT "OTA_SEGNOINIT"
+	#pragma SEGCONST "OTA_SEGCONST"
+#endif
+#include "common.h"
+#include "mcu.h"
+#include "lazurite.h"
+#include "swtimer.h"
+#include "driver_timer.h"
+#include "driver_irq.h"
+
+//********************************************************************************
+//   global parameters
+//********************************************************************************
+
+//********************************************************************************
+//   local definitions
+//********************************************************************************
+#define SWTIMER_CH			6			// 16bit timer 6/7
+#define SWTIMER_TMCON		0xE8		// one-shot, LSCLK/32 = 1024Hz
+#define SWTIMER_MAX_MS		64000		// longer deadlines are reached in steps of 64 sec
+
+//********************************************************************************
+//   local parameters
+//********************************************************************************
+static SW_TIMER *swtimer_head = NULL;	// queue of active timers in order of expiry
+
+//********************************************************************************
+//   local function definitions
+//********************************************************************************
+static void swtimer_isr(void);
+
+//********************************************************************************
+//   local functions
+//********************************************************************************
+// timers with the same expiry are kept in order of start
+static void swtimer_insert(SW_TIMER *timer)
+{
+	SW_TIMER **p = &swtimer_head;
+
+	while ((*p != NULL) && ((int32_t)((*p)->expire - timer->expire) <= 0)) {
+		p = &(*p)->next;
+	}
+	timer->next = *p;
+	*p = timer;
+	timer->active = true;
+}
+
+static void swtimer_remove(SW_TIMER *timer)
+{
+	SW_TIMER **p = &swtimer_head;
+
+	while (*p != NULL) {
+		if (*p == timer) {
+			*p = timer->next;
+			break;
+		}
+		p = &(*p)->next;
+	}
+	timer->next = NULL;
+	timer->active = false;
+}
+
+// program timer 6/7 to the first deadline of the queue.
+// the timer is stopped while the queue is empty, so no periodic wakeup remains.
+static void swtimer_program(uint32_t now)
+{
+	int32_t diff;
+	uint16_t count;
+
+	if (swtimer_head == NULL) {
+		timer_16bit_stop(SWTIMER_CH);
+		return;
+	}
+	diff = (int32_t)(swtimer_head->expire - now);
+	if (diff <= 0) {
+		count = 1;
+	} else if (diff >= SWTIMER_MAX_MS) {
+		count = 0xFFFF;
+	} else {
+		count = (uint16_t)((((uint32_t)diff << 7) + 124) / 125);	// ms * 1.024, round up
+	}
+	timer_16bit_set(SWTIMER_CH, SWTIMER_TMCON, count, swtimer_isr);
+	timer_16bit_start(SWTIMER_CH);
+}
+
+static void swtimer_isr(void)
+{
+	SW_TIMER *timer;
+	uint32_t now;
+
+	while (1) {
+		dis_interrupts(DI_SWTIMER);
+		now = millis();
+		timer = swtimer_head;
+		if ((timer == NULL) || ((int32_t)(now - timer->expire) < 0)) {
+			break;
+		}
+		swtimer_head = timer->next;
+		timer->next = NULL;
+		timer->active = false;
+		if (timer->period != 0) {
+			timer->expire += timer->period;
+			if ((int32_t)(now - timer->expire) >= 0) {
+				timer->expire = now + timer->period;		// skip missed periods
+			}
+			swtimer_insert(timer);
+		}
+		enb_interrupts(DI_SWTIMER);
+
+		// callback may start or stop timers including itself
+		if (timer->func != NULL) {
+			timer->func(timer);
+		}
+	}
+	swtimer_program(now);
+	enb_interrupts(DI_SWTIMER);
+}
+
+// start timer. func is called in interrupt after ms, then every period ms if period != 0.
+// an active timer is restarted.
+void swtimer_start(SW_TIMER *timer, uint32_t ms, uint32_t period, void (*func)(SW_TIMER *timer))
+{
+	uint32_t now;
+
+	dis_interrupts(DI_SWTIMER);
+	swtimer_remove(timer);
+	now = millis();
+	timer->expire = now + ms;
+	timer->period = period;
+	timer->func = func;
+	swtimer_insert(timer);
+	if (swtimer_head == timer) {
+		swtimer_program(now);
+	}
+	enb_interrupts(DI_SWTIMER);
+}
+
+void swtimer_stop(SW_TIMER *timer)
+{
+	bool first;
+
+	dis_interrupts(DI_SWTIMER);
+	first = (swtimer_head == timer) ? true : false;
+	swtimer_remove(timer);
+	if (first) {
+		swtimer_program(millis());
+	}
+	enb_interrupts(DI_SWTIMER);
+}
+
+bool swtimer_active(SW_TIMER *timer)
+{
+	return timer->active;
+}
+
+// execute handler while interrupt is disabled (MIE = 0)
+void swtimer_check_irq(void)
+{
+	if (QTM7 == 1) {
+		QTM7 = 0;
+		swtimer_isr();
+	}
+}
@@ -0,0 +1,53 @@
+/* FILE NAME: swtimer.h
+ *
+ * Copyright (c) 2015  Lapis Semiconductor Co.,Ltd.
+ * All rights reserved.
+ *
+ * This program is free software: you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public License
+ * as published by the Free Software Foundation, either version 3 of
+ * the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef _SWTIMER_H_
+#define _SWTIMER_H_
+
+#include "common.h"
+
+
+//********************************************************************************
+//   global definitions
+//********************************************************************************
+// Software timer. All timers share timer 6/7, which is programmed as one-shot
+// to the earliest deadline. Deadlines are millis() values.
+// SW_TIMER is owned by the caller and must not be released while it is active.
+typedef struct _SW_TIMER {
+	uint32_t	expire;						// millis() at expiry
+	uint32_t	period;						// 0 = one-shot, otherwise interval in ms
+	void		(*func)(struct _SW_TIMER *timer);	// called in interrupt when expired
+	struct _SW_TIMER *next;					// used by swtimer
+	volatile bool active;
+} SW_TIMER;
+
+//********************************************************************************
+//   global parameters
+//********************************************************************************
+//********************************************************************************
+//   extern function definitions
+//********************************************************************************
+extern void swtimer_start(SW_TIMER *timer, uint32_t ms, uint32_t period, void (*func)(SW_TIMER *timer));
+extern void swtimer_stop(SW_TIMER *timer);
+extern bool swtimer_active(SW_TIMER *timer);
+extern void swtimer_check_irq(void);
+
+#endif // _SWTIMER_H_
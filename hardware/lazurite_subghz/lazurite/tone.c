@@ -26,6 +26,7 @@
 #include "driver_ftm_timer.h"
 #include "serial.h"
 #include "mcu.h"
+#include "lp_manage.h"
 
 //********************************************************************************
 //   global parameters
@@ -47,6 +48,7 @@ static volatile int32_t tone_toggle_count;
 static uint8_t drv_tone_pin;
 static uint8_t tone_val;
 static uint8_t tone_ch=0;
+static bool tone_playing = false;		// LP_NEED_HSCLK is voted while playing
 
 //********************************************************************************
 //   local function definitions
@@ -55,6 +57,14 @@ void timer_tone_isr(void);
 //********************************************************************************
 //   local functions
 //********************************************************************************
+// FTM is clocked by HSCLK. keep HSCLK in idle while tone is playing
+static void tone_vote(bool playing)
+{
+	if(tone_playing == playing) return;
+	tone_playing = playing;
+	if(playing) lp_addConstraint(LP_NEED_HSCLK);
+	else lp_removeConstraint(LP_NEED_HSCLK);
+}
 
 #define TONE_BASE_CLOCK		4000000L
 #define TONE_FTM_CH			3
@@ -67,6 +77,7 @@ void timer_tone_isr(void)
 		{
 			drv_digitalWrite(drv_tone_pin, LOW);		// reset port to 0
 			ftm_timer_stop(tone_ch);
+			tone_vote(false);
 			return;
 		}
 	}
@@ -91,6 +102,7 @@ void noTone()
 {
 	ftm_timer_stop(tone_ch);
 	ftm_timer_clear_irq(tone_ch);
+	tone_vote(false);
 }
 
 void tone(uint8_t pin, uint16_t frequency, long duration)
@@ -115,6 +127,7 @@ void tone(uint8_t pin, uint16_t frequency, long duration)
 	
 	// time setting(direct access to ML620Q504H)
 	ftm_timer_set(tone_ch,0x0021,timer_count,timer_tone_isr);
+	tone_vote(true);
 	
 	return;
 }
@@ -32,9 +32,35 @@
 #include "binary.h"
 #include "driver_irq.h"
 #include "driver_i2c.h"
+#include "driver_ltbc.h"
+#include "lp_manage.h"
 //********************************************************************************
 //   local definitions
 //********************************************************************************
+#define I2C_XFER_IDLE		0		// no asynchronous transaction on bus
+#define I2C_XFER_TX			1		// write sequence of asynchronous transaction
+#define I2C_XFER_RX			2		// read sequence of asynchronous transaction
+
+#define I2C_SPEED_100K		0x00	// I2CnMOD.I2nMD = standard mode
+#define I2C_SPEED_400K		0x02	// I2CnMOD.I2nMD = fast mode
+
+#define I2C_RECOVER_CLOCKS	9		// max clocks to release SDA held by slave
+#define I2C_RECOVER_WAIT	16		// loop count of half period of recovery clock (about 5us)
+
+// LTBC0INT is 128Hz by LTBINT set in ltbc_init(). ms is rounded up, and 1 count is added
+// to cover the count in progress, so that timeout is not shorter than ms.
+#define I2C_MS_TO_LTBC(ms)	((UINT16)((((UINT32)(ms) << 7) + 999) / 1000) + 1)
+
+typedef struct {
+	UCHAR	address;		// I2C slave address(7bit)
+	UINT16	count;			// number of errors
+} _I2C_ERROR;
+
+typedef struct {
+	UCHAR	address;		// I2C slave address(7bit)
+	UCHAR	speed;			// I2C_SPEED_xxx
+} _I2C_CLOCK;
+
 typedef struct {
 	UCHAR	*rx_buffer;		// buffer of RX
 	UINT16	rx_index;		// buffer pointer of RX
@@ -45,6 +71,13 @@ typedef struct {
 	CHAR   	status;			// current status
 	BOOLEAN	bStop;			// stop code (false = no, true = required)
 	UCHAR	err_code;		//
+	I2C_XFER *xfer_head;	// queue of asynchronous transaction
+	I2C_XFER *xfer_tail;
+	UCHAR	xfer_count;		// number of queued transaction
+	UCHAR	xfer_phase;		// I2C_XFER_xxx
+	BOOLEAN	xfer_callback;	// true = in callback of asynchronous transaction
+	volatile UINT16	remain;	// remaining LTBC count of current sequence
+	volatile BOOLEAN recover;	// true = stopped by timeout. bus is recovered by i2c_poll()
 } _I2C_PARAM;
 
 //********************************************************************************
@@ -54,6 +87,20 @@ static _I2C_PARAM	I2C[2] ={{false},{false}};
 //********************************************************************************
 //   local parameters
 //********************************************************************************
+static struct {
+	UCHAR	speed;			// default speed
+	UCHAR	current;		// speed set to hardware
+	UCHAR	num;			// number of devices in table
+	_I2C_CLOCK table[I2C_CLOCK_TABLE_SIZE];
+} i2c_clock[2] = {{I2C_SPEED_400K, I2C_SPEED_400K}, {I2C_SPEED_400K, I2C_SPEED_400K}};
+
+static struct {
+	UCHAR	num;			// number of devices in table
+	_I2C_ERROR table[I2C_ERROR_TABLE_SIZE];
+} i2c_error[2];
+
+static UINT16 i2c_timeout_count[2] = {I2C_MS_TO_LTBC(I2C_TIMEOUT_DEFAULT), I2C_MS_TO_LTBC(I2C_TIMEOUT_DEFAULT)};	// 0 = no timeout
+static BOOLEAN i2c_watchdog_on = false;	// true = handler is attached to LTBC
 
 //********************************************************************************
 //   local function definitions
@@ -63,6 +110,19 @@ void i2c1_isr(void);
 void i2c0_isr(void);
 BOOLEAN i2c_check_read_last_data(UCHAR ch);
 unsigned char i2c_update_err_code(UCHAR ch, unsigned short index);
+static void i2c_xfer_start(UCHAR ch);
+static void i2c_xfer_next(UCHAR ch, CHAR prev_status);
+static void i2c_xfer_discard(UCHAR ch);
+static void i2c_apply_clock(UCHAR ch, UCHAR address);
+static UCHAR i2c_clock_to_speed(UINT32 clock);
+static void i2c_count_error(UCHAR ch);
+static void i2c_watchdog_start(UCHAR ch);
+static unsigned short i2c_watchdog(unsigned short count);
+static void i2c_timeout(UCHAR ch);
+static void i2c_recover_scl(UCHAR ch, BOOLEAN release);
+static void i2c_recover_sda(UCHAR ch, BOOLEAN release);
+static BOOLEAN i2c_recover_sda_level(UCHAR ch);
+static void i2c_recover_wait(void);
 
 
 //********************************************************************************
@@ -77,6 +137,11 @@ void i2c_init(UCHAR ch)
 	// reset common flag
 	I2C[ch].status = I2C_MODE_IDLE;
 	I2C[ch].err_code = 0;
+	I2C[ch].remain = 0;
+	I2C[ch].recover = false;
+	i2c_xfer_discard(ch);						// release descriptors of previous session, such as i2c_write_read
+	
+	i2c_clock[ch].current = i2c_clock[ch].speed;
 	
 	// Initializing hardware
 	if(ch == 0)
@@ -84,7 +149,7 @@ void i2c_init(UCHAR ch)
 		clear_bit(DI2C0);
 		P40D=1;P40MD1 = 0; P40MD0 = 1; P40C1 = 1; P40C0 = 0;	// port setting
 		P41D=1;P41MD1 = 0; P41MD0 = 1; P41C1 = 1; P41C0 = 0;	// port setting
-		I2C0MOD = 0x0203;									// OSCLK=16M, 400kbps, I2C start
+		I2C0MOD = 0x0201 | i2c_clock[ch].speed;				// OSCLK=16M, default speed, I2C start
 		irq_sethandler(IRQ_NO_I2C0INT,i2c0_isr);		// set interrupt handler
 		EI2C0 = 1;
 	}
@@ -93,7 +158,7 @@ void i2c_init(UCHAR ch)
 		clear_bit(DI2C1);
 		P35D=1,P35MD1 = 0;	P35MD0 = 1;P35C1 = 1; P35C0 = 0;	// port setting
 		P34D=1,P34MD1 = 0;	P34MD0 = 1;P34C1 = 1; P34C0 = 0;	// port setting
-		I2C1MOD = 0x0203;									// OSCLK=16M, 400kbps, I2C start
+		I2C1MOD = 0x0201 | i2c_clock[ch].speed;				// OSCLK=16M, default speed, I2C start
 		irq_sethandler(IRQ_NO_I2C1INT,i2c1_isr);		// set interrupt handler
 		EI2C1 = 1;
 	}
@@ -133,6 +198,7 @@ void i2c_set_tx_buf(UCHAR ch,UCHAR *txbufp, UINT16 length)
 
 void i2c_set_address(UCHAR ch, UCHAR address)
 {
+	i2c_apply_clock(ch, address);
 	if(ch == 0)
 	{
 		write_reg8(I2C0SA,(address << 1));		// set address to upper 7bit, LSB is RD/RW bit
@@ -164,8 +230,8 @@ void i2c_send_stopbit(UCHAR ch)
 
 void i2c_start(UCHAR ch, BOOLEAN write, BOOLEAN cont)
 {
-	UCHAR *reg_SA;
-	UCHAR *reg_CON;
+	volatile UCHAR *reg_SA;
+	volatile UCHAR *reg_CON;
 	UCHAR start_code = 0;
 
 	if(ch>=2) return;
@@ -210,6 +276,8 @@ void i2c_start(UCHAR ch, BOOLEAN write, BOOLEAN cont)
 		start_code |= 0x05;					// restart
 	}
 	
+	i2c_watchdog_start(ch);
+
 	*reg_CON = start_code;					// start
 	
 	return;
@@ -220,11 +288,13 @@ void i2c_start(UCHAR ch, BOOLEAN write, BOOLEAN cont)
 // 15.09.20 Naotaka Saito correct return value of endTransmission
 void i2c_isr(UCHAR ch)
 {
-	UCHAR *reg_CON;
-	UCHAR *reg_TD;
-	UCHAR *reg_RD;
+	volatile UCHAR *reg_CON;
+	volatile UCHAR *reg_TD;
+	volatile UCHAR *reg_RD;
 	UCHAR startcode = 0;
 	UCHAR i2c_result = 0;
+	CHAR prev_status = I2C[ch].status;
+	UCHAR prev_err = I2C[ch].err_code;
 	
 //	if(	I2C[ch].flag == false) return;
 	
@@ -326,11 +396,32 @@ void i2c_isr(UCHAR ch)
 	case I2C_MODE_READY:
 		break;
 	// ****************** ERROR *****************
-	default:
-		while(1){}
+	case I2C_MODE_ERROR:										// release bus
+		I2C[ch].err_code = I2C_RESULT_ERROR;
+		i2c_force_stop(ch);
+		break;
+	default:													// interrupt when I2C is not used
 		break;
 	}
 	if(startcode != 0) *reg_CON = startcode;
+	if((I2C[ch].err_code != I2C_RESULT_OK) && (prev_err == I2C_RESULT_OK))
+	{
+		i2c_count_error(ch);
+	}
+	if(I2C[ch].status <= I2C_MODE_READY) I2C[ch].remain = 0;	// stop deadline
+	
+	// asynchronous transaction
+	if((I2C[ch].status == I2C_MODE_READY) && (I2C[ch].xfer_head != NULL))
+	{
+		if(I2C[ch].xfer_phase == I2C_XFER_IDLE)
+		{
+			i2c_xfer_start(ch);					// bus was used by other sequence
+		}
+		else
+		{
+			i2c_xfer_next(ch, prev_status);
+		}
+	}
 	
 	return;
 }
@@ -393,6 +484,7 @@ void i2c_force_stop(UCHAR ch)
 {
 	i2c_send_stopbit(ch);
 	I2C[ch].status = I2C_MODE_STOPBIT;
+	i2c_watchdog_start(ch);						// stop bit may not be completed
 }
 
 void i2c_close(UCHAR ch)
@@ -416,8 +508,10 @@ void i2c_close(UCHAR ch)
 		set_bit(DI2C1);								// disenable I2C1
 		break;
 	default:
-		break;
+		return;
 	}
+	I2C[ch].recover = false;
+	i2c_xfer_discard(ch);							// after I2C_MODE_DIS, so that callback cannot submit again
 	return;
 }
 
@@ -425,3 +519,472 @@ UINT16 i2c_write_amount(UCHAR ch)
 {
 	return(I2C[ch].tx_index);
 }
+
+// queue asynchronous transaction
+// transaction is started immediately when bus is ready, and following transactions
+// are started in interrupt one by one. after timeout, they are started by i2c_poll().
+// return = false : parameter error or I2C is not initialized
+BOOLEAN i2c_submit(UCHAR ch, I2C_XFER *xfer)
+{
+	BOOLEAN lock;
+
+	if((ch >= 2) || (xfer == NULL)) return false;
+	if((I2C[ch].status < I2C_MODE_READY) && (I2C[ch].recover == false)) return false;
+
+	xfer->result = I2C_RESULT_BUSY;
+	xfer->rx_amount = 0;
+	xfer->next = NULL;
+
+	lock = (I2C[ch].xfer_callback == false);		// interrupt is already disabled in callback
+	if(lock) dis_interrupts(DI_I2C);
+	if(I2C[ch].xfer_head == NULL)
+	{
+		I2C[ch].xfer_head = xfer;
+		I2C[ch].xfer_tail = xfer;
+		I2C[ch].xfer_count = 1;
+		lp_addConstraint(LP_NEED_HSCLK);			// I2C stops in HALT-H mode
+		if(I2C[ch].status == I2C_MODE_READY)
+		{
+			i2c_xfer_start(ch);
+		}
+	}
+	else
+	{
+		I2C[ch].xfer_tail->next = xfer;
+		I2C[ch].xfer_tail = xfer;
+		I2C[ch].xfer_count++;
+	}
+	if(lock) enb_interrupts(DI_I2C);
+
+	return true;
+}
+
+UCHAR i2c_xfer_pending(UCHAR ch)
+{
+	if(ch >= 2) return 0;
+	return I2C[ch].xfer_count;
+}
+
+// convert clock(Hz) to speed mode of hardware
+static UCHAR i2c_clock_to_speed(UINT32 clock)
+{
+	return (clock >= 400000UL) ? I2C_SPEED_400K : I2C_SPEED_100K;
+}
+
+// set default bus clock. devices which are not in clock table use this clock.
+// UINT32 clock = 100000 or 400000(Hz). 400kHz or more is fast mode, otherwise standard mode
+void i2c_set_clock(UCHAR ch, UINT32 clock)
+{
+	if(ch >= 2) return;
+	i2c_clock[ch].speed = i2c_clock_to_speed(clock);
+	return;
+}
+
+// set bus clock for each device, so that slow and fast devices can share a bus.
+// UINT32 clock = bus clock(Hz). 0 = remove the device from table
+// return = false : table is full
+BOOLEAN i2c_set_device_clock(UCHAR ch, UCHAR address, UINT32 clock)
+{
+	UCHAR i;
+
+	if(ch >= 2) return false;
+	for(i = 0; i < i2c_clock[ch].num; i++)
+	{
+		if(i2c_clock[ch].table[i].address == address) break;
+	}
+	if(clock == 0)
+	{
+		if(i < i2c_clock[ch].num)
+		{
+			i2c_clock[ch].num--;
+			i2c_clock[ch].table[i] = i2c_clock[ch].table[i2c_clock[ch].num];
+		}
+		return true;
+	}
+	if(i >= I2C_CLOCK_TABLE_SIZE) return false;
+	if(i == i2c_clock[ch].num) i2c_clock[ch].num++;
+	i2c_clock[ch].table[i].address = address;
+	i2c_clock[ch].table[i].speed = i2c_clock_to_speed(clock);
+	return true;
+}
+
+// change bus speed for the device.
+// speed is not changed during restart sequence, because bus is not released.
+static void i2c_apply_clock(UCHAR ch, UCHAR address)
+{
+	UCHAR i;
+	UCHAR speed = i2c_clock[ch].speed;
+
+	for(i = 0; i < i2c_clock[ch].num; i++)
+	{
+		if(i2c_clock[ch].table[i].address == address)
+		{
+			speed = i2c_clock[ch].table[i].speed;
+			break;
+		}
+	}
+	if(speed == i2c_clock[ch].current) return;
+
+	if(ch == 0)
+	{
+		if((I2C0CON0 & 0x01) != 0) return;			// bus is in use
+		I2C0MODL = 0x00;							// I2C stop
+		I2C0MODL = speed | 0x01;					// set speed and I2C start
+	}
+	else if(ch == 1)
+	{
+		if((I2C1CON0 & 0x01) != 0) return;			// bus is in use
+		I2C1MODL = 0x00;							// I2C stop
+		I2C1MODL = speed | 0x01;					// set speed and I2C start
+	}
+	i2c_clock[ch].current = speed;
+	return;
+}
+
+// start write sequence followed by read sequence with repeated start, such as register read.
+// whole sequence is executed in interrupt, and stop bit is sent at the end.
+// end of sequence can be checked by i2c_get_status() same as i2c_start().
+// error code and received length are got by i2c_get_err_status() and i2c_read_amount().
+// return = false : parameter error or previous sequence is not completed
+BOOLEAN i2c_write_read(UCHAR ch, UCHAR address, UCHAR *reg_buf, UINT16 reg_len, UCHAR *rx_buf, UINT16 rx_len)
+{
+	static I2C_XFER xfer[2];
+
+	if(ch >= 2) return false;
+	if(xfer[ch].result == I2C_RESULT_BUSY) return false;
+
+	xfer[ch].address = address;
+	xfer[ch].tx_buf = reg_buf;
+	xfer[ch].tx_len = reg_len;
+	xfer[ch].rx_buf = rx_buf;
+	xfer[ch].rx_len = rx_len;
+	xfer[ch].stop = true;
+	xfer[ch].callback = NULL;
+
+	return i2c_submit(ch, &xfer[ch]);
+}
+
+// start transaction of head of queue
+static void i2c_xfer_start(UCHAR ch)
+{
+	I2C_XFER *xfer = I2C[ch].xfer_head;
+
+	i2c_set_address(ch, xfer->address);
+	if((xfer->tx_len != 0) || (xfer->rx_len == 0))
+	{
+		i2c_set_tx_buf(ch, xfer->tx_buf, xfer->tx_len);
+		I2C[ch].rx_index = 0;
+		I2C[ch].xfer_phase = I2C_XFER_TX;
+		i2c_start(ch, true, (xfer->rx_len == 0) ? xfer->stop : false);
+	}
+	else
+	{
+		i2c_set_rx_buf(ch, xfer->rx_buf, xfer->rx_len);
+		I2C[ch].xfer_phase = I2C_XFER_RX;
+		i2c_start(ch, false, xfer->stop);
+	}
+	return;
+}
+
+// update asynchronous transaction when bus becomes ready
+static void i2c_xfer_next(UCHAR ch, CHAR prev_status)
+{
+	I2C_XFER *xfer = I2C[ch].xfer_head;
+
+	// write sequence is completed. start read sequence by repeated start.
+	if((I2C[ch].xfer_phase == I2C_XFER_TX) && (I2C[ch].err_code == I2C_RESULT_OK) && (xfer->rx_len != 0))
+	{
+		i2c_set_rx_buf(ch, xfer->rx_buf, xfer->rx_len);
+		I2C[ch].xfer_phase = I2C_XFER_RX;
+		i2c_start(ch, false, xfer->stop);
+		return;
+	}
+
+	// release bus before completion in case of error
+	if((I2C[ch].err_code != I2C_RESULT_OK) && (prev_status != I2C_MODE_STOPBIT))
+	{
+		i2c_force_stop(ch);
+		return;
+	}
+
+	// completion
+	xfer->rx_amount = I2C[ch].rx_index;
+	xfer->result = I2C[ch].err_code;
+	I2C[ch].xfer_head = xfer->next;
+	if(I2C[ch].xfer_head == NULL) I2C[ch].xfer_tail = NULL;
+	I2C[ch].xfer_count--;
+	I2C[ch].xfer_phase = I2C_XFER_IDLE;
+	if(I2C[ch].xfer_count == 0) lp_removeConstraint(LP_NEED_HSCLK);
+
+	if(xfer->callback)
+	{
+		I2C[ch].xfer_callback = true;
+		xfer->callback(xfer);
+		I2C[ch].xfer_callback = false;
+	}
+
+	// callback may start next transaction by i2c_submit. after timeout, bus is recovered first
+	if((I2C[ch].xfer_head != NULL) && (I2C[ch].xfer_phase == I2C_XFER_IDLE) && (I2C[ch].status == I2C_MODE_READY))
+	{
+		i2c_xfer_start(ch);
+	}
+	return;
+}
+
+// complete all asynchronous transactions in queue with I2C_RESULT_ERROR when I2C is closed
+static void i2c_xfer_discard(UCHAR ch)
+{
+	I2C_XFER *xfer;
+	I2C_XFER *next;
+
+	dis_interrupts(DI_I2C);
+	xfer = I2C[ch].xfer_head;
+	if(I2C[ch].xfer_count != 0) lp_removeConstraint(LP_NEED_HSCLK);
+	I2C[ch].xfer_head = NULL;
+	I2C[ch].xfer_tail = NULL;
+	I2C[ch].xfer_count = 0;
+	I2C[ch].xfer_phase = I2C_XFER_IDLE;
+	enb_interrupts(DI_I2C);
+
+	while(xfer != NULL)
+	{
+		next = xfer->next;							// descriptor may be reused in callback
+		xfer->result = I2C_RESULT_ERROR;
+		if(xfer->callback) xfer->callback(xfer);
+		xfer = next;
+	}
+	return;
+}
+
+// set timeout of sequence. sequence which is not completed in timeout is stopped, the
+// bus is recovered by i2c_poll() and error code is set to I2C_RESULT_TIMEOUT.
+// timeout is checked by LTBC interrupt every 7.8ms, and is applied from next sequence.
+// UINT16 ms = timeout(ms). 0 = wait forever
+void i2c_set_timeout(UCHAR ch, UINT16 ms)
+{
+	if(ch >= 2) return;
+	i2c_timeout_count[ch] = (ms == 0) ? 0 : I2C_MS_TO_LTBC(ms);
+	return;
+}
+
+// start deadline of sequence. deadline is checked by LTBC interrupt.
+// status must be set before, so that handler does not detach itself.
+static void i2c_watchdog_start(UCHAR ch)
+{
+	I2C[ch].remain = i2c_timeout_count[ch];
+	if((I2C[ch].remain != 0) && (i2c_watchdog_on == false))
+	{
+		i2c_watchdog_on = true;
+		ltbc_attach_handler(LTBC_SLOT_I2C, 1, i2c_watchdog);
+	}
+	return;
+}
+
+// LTBC handler to check deadline of sequence
+// handler is detached when no sequence is running.
+static unsigned short i2c_watchdog(unsigned short count)
+{
+	UCHAR ch;
+
+	for(ch = 0; ch < 2; ch++)
+	{
+		if(I2C[ch].remain == 0) continue;
+		if(I2C[ch].status <= I2C_MODE_READY)
+		{
+			I2C[ch].remain = 0;					// completed
+			continue;
+		}
+		I2C[ch].remain--;
+		if(I2C[ch].remain == 0)
+		{
+			i2c_timeout(ch);					// next transaction may be started
+		}
+	}
+	if((I2C[0].remain == 0) && (I2C[1].remain == 0))
+	{
+		i2c_watchdog_on = false;
+		return 0;								// detach
+	}
+	return 1;
+}
+
+// stop sequence which is over deadline. called in LTBC interrupt.
+// recovery of bus takes 9 clocks of SCL by port, so that only I2C is stopped here and
+// the bus is recovered by i2c_poll() in task context.
+static void i2c_timeout(UCHAR ch)
+{
+	I2C[ch].err_code = I2C_RESULT_TIMEOUT;
+	i2c_count_error(ch);
+	if(ch == 0)
+	{
+		I2C0MODL &= ~0x01;						// I2C stop
+		QI2C0 = 0;
+	}
+	else
+	{
+		I2C1MODL &= ~0x01;
+		QI2C1 = 0;
+	}
+	I2C[ch].status = I2C_MODE_IDLE;
+	I2C[ch].recover = true;
+
+	// complete asynchronous transaction with error. next one waits for recovery
+	if((I2C[ch].xfer_head != NULL) && (I2C[ch].xfer_phase != I2C_XFER_IDLE))
+	{
+		i2c_xfer_next(ch, I2C_MODE_STOPBIT);
+	}
+	return;
+}
+
+// control SCL/SDA as general port of open drain
+// BOOLEAN release = true : line is pulled up,  false : line is driven to low
+static void i2c_recover_scl(UCHAR ch, BOOLEAN release)
+{
+	if(ch == 0) P41DIR = release;
+	else P35DIR = release;
+}
+
+static void i2c_recover_sda(UCHAR ch, BOOLEAN release)
+{
+	if(ch == 0) P40DIR = release;
+	else P34DIR = release;
+}
+
+static BOOLEAN i2c_recover_sda_level(UCHAR ch)
+{
+	return (ch == 0) ? P40D : P34D;
+}
+
+static void i2c_recover_wait(void)
+{
+	UCHAR i;
+	for(i = 0; i < I2C_RECOVER_WAIT; i++)
+	{
+		__asm("nop");
+	}
+}
+
+// release bus which is stuck by slave.
+// slave holding SDA low is clocked out by up to 9 clocks of SCL, and then stop condition is sent.
+// I2C hardware is reset, and status becomes I2C_MODE_READY.
+// return = false : SDA is still low. slave may be broken or power cycle is required.
+BOOLEAN i2c_bus_recover(UCHAR ch)
+{
+	UCHAR i;
+	BOOLEAN result;
+
+	if(ch >= 2) return false;
+	if(I2C[ch].status == I2C_MODE_DIS) return false;
+
+	// I2C stop and change port to general port
+	if(ch == 0)
+	{
+		I2C0MODL &= ~0x01;
+		P40D = 0; P40DIR = 1; P40MD1 = 0; P40MD0 = 0;
+		P41D = 0; P41DIR = 1; P41MD1 = 0; P41MD0 = 0;
+	}
+	else
+	{
+		I2C1MODL &= ~0x01;
+		P34D = 0; P34DIR = 1; P34MD1 = 0; P34MD0 = 0;
+		P35D = 0; P35DIR = 1; P35MD1 = 0; P35MD0 = 0;
+	}
+	i2c_recover_wait();
+
+	// clock out until slave releases SDA
+	for(i = 0; (i < I2C_RECOVER_CLOCKS) && (i2c_recover_sda_level(ch) == 0); i++)
+	{
+		i2c_recover_scl(ch, false);
+		i2c_recover_wait();
+		i2c_recover_scl(ch, true);
+		i2c_recover_wait();
+	}
+
+	// stop condition
+	i2c_recover_scl(ch, false);
+	i2c_recover_wait();
+	i2c_recover_sda(ch, false);
+	i2c_recover_wait();
+	i2c_recover_scl(ch, true);
+	i2c_recover_wait();
+	i2c_recover_sda(ch, true);
+	i2c_recover_wait();
+	result = (i2c_recover_sda_level(ch) != 0);
+
+	// restore I2C
+	if(ch == 0)
+	{
+		P40DIR = 0; P40D = 1; P40MD0 = 1;
+		P41DIR = 0; P41D = 1; P41MD0 = 1;
+		I2C0MODL = i2c_clock[ch].current | 0x01;
+		QI2C0 = 0;
+	}
+	else
+	{
+		P34DIR = 0; P34D = 1; P34MD0 = 1;
+		P35DIR = 0; P35D = 1; P35MD0 = 1;
+		I2C1MODL = i2c_clock[ch].current | 0x01;
+		QI2C1 = 0;
+	}
+	I2C[ch].status = I2C_MODE_READY;
+	I2C[ch].remain = 0;
+	I2C[ch].recover = false;
+
+	return result;
+}
+
+// recover bus stopped by timeout, and start asynchronous transactions queued meanwhile.
+// must be called in task context, such as before each sequence and while waiting queue.
+void i2c_poll(UCHAR ch)
+{
+	if((ch >= 2) || (I2C[ch].recover == false)) return;
+	i2c_bus_recover(ch);
+	dis_interrupts(DI_I2C);
+	if((I2C[ch].xfer_head != NULL) && (I2C[ch].xfer_phase == I2C_XFER_IDLE) && (I2C[ch].status == I2C_MODE_READY))
+	{
+		i2c_xfer_start(ch);
+	}
+	enb_interrupts(DI_I2C);
+	return;
+}
+
+// count error of the device which is addressed by current sequence
+static void i2c_count_error(UCHAR ch)
+{
+	UCHAR i;
+	UCHAR address = ((ch == 0) ? I2C0SA : I2C1SA) >> 1;
+
+	for(i = 0; i < i2c_error[ch].num; i++)
+	{
+		if(i2c_error[ch].table[i].address == address) break;
+	}
+	if(i >= I2C_ERROR_TABLE_SIZE) return;					// table is full
+	if(i == i2c_error[ch].num)
+	{
+		i2c_error[ch].table[i].address = address;
+		i2c_error[ch].table[i].count = 0;
+		i2c_error[ch].num++;
+	}
+	if(i2c_error[ch].table[i].count != 0xFFFF) i2c_error[ch].table[i].count++;
+	return;
+}
+
+// return = number of errors of the device(ANACK, DNACK, ERROR and TIMEOUT)
+UINT16 i2c_get_error_count(UCHAR ch, UCHAR address)
+{
+	UCHAR i;
+
+	if(ch >= 2) return 0;
+	for(i = 0; i < i2c_error[ch].num; i++)
+	{
+		if(i2c_error[ch].table[i].address == address) return i2c_error[ch].table[i].count;
+	}
+	return 0;
+}
+
+void i2c_clear_error_count(UCHAR ch)
+{
+	if(ch >= 2) return;
+	i2c_error[ch].num = 0;
+	return;
+}
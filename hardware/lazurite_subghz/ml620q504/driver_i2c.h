@@ -27,6 +27,9 @@
 #include <stddef.h>
 
 #define I2C_BUFFER_LENGTH 32
+#define I2C_CLOCK_TABLE_SIZE 4				// number of devices which can have own clock
+#define I2C_ERROR_TABLE_SIZE 4				// number of devices which error is counted
+#define I2C_TIMEOUT_DEFAULT 100				// default timeout of sequence(ms)
 
 //********************************************************************************
 //   global definitions
@@ -48,6 +51,24 @@
 #define I2C_RESULT_ANACK	2		// address send, nack receive
 #define I2C_RESULT_DNACK	3		// data send, nack receive
 #define I2C_RESULT_ERROR	4		// other error
+#define I2C_RESULT_TIMEOUT	5		// sequence is not completed in timeout. bus is recovered by i2c_poll()
+#define I2C_RESULT_BUSY		0xFF	// asynchronous transaction is not completed
+
+// descriptor of asynchronous transaction
+// write sequence is executed at first, and then read sequence is executed by repeated start.
+// descriptor and buffers must be kept by caller until the transaction is completed.
+typedef struct _I2C_XFER {
+	UCHAR	address;						// I2C slave address(7bit)
+	UCHAR	*tx_buf;						// data to be sent
+	UINT16	tx_len;							// 0 = skip write sequence
+	UCHAR	*rx_buf;						// buffer to store receiving data
+	UINT16	rx_len;							// 0 = skip read sequence
+	BOOLEAN	stop;							// true = send stop bit at end of transaction
+	void	(*callback)(struct _I2C_XFER *xfer);	// called in interrupt when completed, or by i2c_close. NULL is available
+	volatile UCHAR	result;					// I2C_RESULT_xxx. I2C_RESULT_BUSY until completion. I2C_RESULT_ERROR when discarded by i2c_close
+	volatile UINT16	rx_amount;				// received length
+	struct _I2C_XFER *next;					// used by driver
+} I2C_XFER;
 
 
 //********************************************************************************
@@ -82,6 +103,17 @@ extern UINT16 i2c_read_amount(UCHAR ch);
 extern UINT16 i2c_write_amount(UCHAR ch);
 extern UINT8 i2c_get_err_status(UCHAR ch);
 extern void i2c_force_stop(UCHAR ch);
+extern void i2c_close(UCHAR ch);										// disable I2C and discard queued transactions
+extern BOOLEAN i2c_submit(UCHAR ch, I2C_XFER *xfer);					// queue asynchronous transaction
+extern UCHAR i2c_xfer_pending(UCHAR ch);								// number of transactions not completed
+extern void i2c_set_clock(UCHAR ch, UINT32 clock);						// set default bus clock(Hz)
+extern BOOLEAN i2c_set_device_clock(UCHAR ch, UCHAR address, UINT32 clock);	// set bus clock(Hz) for the device. 0 = use default
+extern BOOLEAN i2c_write_read(UCHAR ch, UCHAR address, UCHAR *reg_buf, UINT16 reg_len, UCHAR *rx_buf, UINT16 rx_len);	// start write and read by repeated start
+extern void i2c_set_timeout(UCHAR ch, UINT16 ms);						// set timeout of sequence(ms). 0 = wait forever
+extern BOOLEAN i2c_bus_recover(UCHAR ch);								// release bus stuck by slave. false = SDA is still low
+extern void i2c_poll(UCHAR ch);											// recover bus after timeout in task context
+extern UINT16 i2c_get_error_count(UCHAR ch, UCHAR address);				// number of errors of the device
+extern void i2c_clear_error_count(UCHAR ch);							// clear all error counters
 
 
 #endif // _DRIVER_I2C_H_
@@ -103,6 +103,11 @@ extern void _intNullHdr(void);
 #define		DI_USER			0x0040
 #define		DI_LTBC			0x0080
 #define		DI_DFLASH		0x0100
+#define		DI_I2C			0x0200
+#define		DI_SPI			0x0400
+#define		DI_SWTIMER		0x0800
+#define		DI_EVENT		0x1000
+#define		DI_LP			0x2000
 #define		DI_INTERRUPT	0x8000
 extern void enb_interrupts(unsigned short irq_ch);
 extern void dis_interrupts(unsigned short irq_ch);
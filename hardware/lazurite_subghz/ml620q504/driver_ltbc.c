@@ -165,3 +165,13 @@ void ltbc_detach_handler(unsigned char num)
 	}
 	return;
 }
+
+// execute handler while interrupt is disabled (MIE = 0)
+void ltbc_check_irq(void)
+{
+	if ((IE7 == 1) && (IRQ7 == 1)) {
+		IRQ7 = 0;
+		ltbc_isr();
+	}
+	return;
+}
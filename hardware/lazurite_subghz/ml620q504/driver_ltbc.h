@@ -24,8 +24,12 @@
 #include "common.h"
 #include "driver_irq.h"
 
+// slot number of handler used by drivers
+#define LTBC_SLOT_I2C	( 7 )		// timeout of I2C sequence
+
 extern void ltbc_init(void);
 extern void ltbc_attach_handler(unsigned char num, unsigned short expire, unsigned short (*func)(unsigned short count));
 extern void ltbc_detach_handler(unsigned char num);
+extern void ltbc_check_irq(void);
 
 #endif  /* _DRIVER_LTBC_H_ */
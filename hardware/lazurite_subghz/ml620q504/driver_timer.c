@@ -55,9 +55,9 @@ const char num_to_bit[]=
 //*************************************************************************************
 void timer_8bit_set(unsigned char ch, unsigned char TMnCON, unsigned char TMnD, void (*func)(void))
 {
-	unsigned char* pTMnD;
-	unsigned char* pTMnC;
-	unsigned char* pTMnCON;
+	volatile unsigned char* pTMnD;
+	volatile unsigned char* pTMnC;
+	volatile unsigned char* pTMnCON;
 	
 	// check ch
 	if(ch >= 8) return;
@@ -107,9 +107,9 @@ void timer_8bit_stop(unsigned char ch)
 
 void timer_16bit_set(unsigned char ch, unsigned char TMnCON, unsigned short TMnnD, void (*func)(void))
 {
-	unsigned short* pTMnnD;
-	unsigned short* pTMnnC;
-	unsigned char* pTMnCON;
+	volatile unsigned short* pTMnnD;
+	volatile unsigned short* pTMnnC;
+	volatile unsigned char* pTMnCON;
 	
 	// check ch
 	if(ch >= 8) return;
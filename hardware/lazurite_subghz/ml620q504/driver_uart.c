@@ -55,46 +55,70 @@
 #define UAF0LSRL_UF0OER		0x02
 #define UAF0LSRL_UF0DR		0x01
 
+#define UAF0FCR_UF0FEN		0x01				// FIFO enable
+#define UAF0FCR_UF0RFR		0x02				// RX FIFO reset
+#define UAF0FCR_UF0TFR		0x04				// TX FIFO reset
+
+#define UARTF_TX_FIFO_DEPTH	16					// depth of hardware TX FIFO of UARTF
+
+typedef struct {
+	const UCHAR *buf;							// pointer of data to be sent
+	size_t len;									// remaining length
+	void (*done)(void);							// callback. it is kept until tx interrupt after last data
+} UART_TX_ASYNC;
+
+typedef struct {
+	int delim;									// delimiter charactor. minus = disabled
+	bool *flag;									// set to true when delimiter is received
+} UART_RX_DELIM;
+
 //********************************************************************************
 //   local parameters
 //********************************************************************************
 
-static UCHAR uart_rx_buf[UART_BUFFER_LENGTH];
-static UCHAR uart_tx_buf[UART_BUFFER_LENGTH];
-static UCHAR uartf_rx_buf[UART_BUFFER_LENGTH];
-static UCHAR uartf_tx_buf[UART_BUFFER_LENGTH];
+static UCHAR uart_rx_buf[UART_RX_BUFFER_LENGTH];
+static UCHAR uart_tx_buf[UART_TX_BUFFER_LENGTH];
+static UCHAR uartf_rx_buf[UARTF_RX_BUFFER_LENGTH];
+static UCHAR uartf_tx_buf[UARTF_TX_BUFFER_LENGTH];
 
 static char uart_tx_flag;							// true = send, false = not send
 static char uartf_tx_flag;							// true = send, false = not send
 char uart_tx_sending=false;
 char uartf_tx_sending=false;
 
+static UART_TX_ASYNC uart_tx_async;
+static UART_TX_ASYNC uartf_tx_async;
+static UART_RX_DELIM uart_rx_delim = { -1, NULL };
+static UART_RX_DELIM uartf_rx_delim = { -1, NULL };
+static UART_STATS uart_stats;
+static UART_STATS uartf_stats;
+
 static FIFO_CTRL uart_tx_fifo = {
-	UART_BUFFER_LENGTH,
+	UART_TX_BUFFER_LENGTH,
 	uart_tx_buf,
 	0,
 	0
 };
 static FIFO_CTRL uart_rx_fifo = {
-	UART_BUFFER_LENGTH,
+	UART_RX_BUFFER_LENGTH,
 	uart_rx_buf,
 	0,
 	0
 };
 
 static FIFO_CTRL uartf_tx_fifo = {
-	UART_BUFFER_LENGTH,
+	UARTF_TX_BUFFER_LENGTH,
 	uartf_tx_buf,
 	0,
 	0
 };
 static FIFO_CTRL uartf_rx_fifo = {
-	UART_BUFFER_LENGTH,
+	UARTF_RX_BUFFER_LENGTH,
 	uartf_rx_buf,
 	0,
 	0
 };
-const char* uart_gpio_adr[] =
+volatile unsigned char* const uart_gpio_adr[] =
 {
 	&P0D,			// UART
 	&P3D,			// UART
@@ -127,6 +151,11 @@ const char uart_gpio_tx_bitmask[] =
 //********************************************************************************
 
 static void uart_tx_isr(void);
+static void uart_set_sending(char* sending_p, char sending);
+static int uart_tx_next(FIFO_CTRL* fifo_p, UART_TX_ASYNC* async_p, UART_STATS* stats_p);
+static void uart_tx_async_done(UART_TX_ASYNC* async_p);
+static UCHAR uartf_tx_fill(void);
+static void uart_rx_store(FIFO_CTRL* fifo_p, UART_RX_DELIM* delim_p, UART_STATS* stats_p, UCHAR data);
 void uart_rx_isr(void);
 void uartf_isr(void);
 
@@ -134,6 +163,15 @@ void uartf_isr(void);
 //   local functions
 //********************************************************************************
 
+// update *_tx_sending and the vote for HSCLK. UART stops in HALT-H mode.
+static void uart_set_sending(char* sending_p, char sending)
+{
+	if(*sending_p == sending) return;
+	*sending_p = sending;
+	if(sending) lp_addConstraint(LP_NEED_HSCLK);
+	else lp_removeConstraint(LP_NEED_HSCLK);
+}
+
 // ----------------------------------------------
 // function  uartf_gpio_init(unsigned char n)
 // (m) = arduino pin number
@@ -144,7 +182,7 @@ void uartf_isr(void);
 // ----------------------------------------------
 void uart_gpio_init(unsigned char n)
 {
-	unsigned char* port;
+	volatile unsigned char* port;
 	unsigned char bit;
 	if(n>5) return;
 	port = uart_gpio_adr[n];
@@ -224,8 +262,10 @@ void uart_begin(UINT32 baud,void (*rxcallback)(void),void (*txcallback)(void))
 	} else {
 		irq_sethandler(IRQ_NO_UA1INT, uart_tx_isr);		// set interrupt handler of tx
 		uart_fifo_init(&uart_tx_fifo);
+		uart_tx_async.len = 0;
+		uart_tx_async.done = NULL;
 		uart_tx_flag = false;
-		uart_tx_sending = false;
+		uart_set_sending(&uart_tx_sending, false);
 	}
 
 	// buffer reset
@@ -253,6 +293,7 @@ void uartf_begin(UINT32 baud)
 	clear_bit(UF0DLAB);
 	
 	write_reg8(UAF0IER,0x07);						// all interrupts are enabled.
+	write_reg8(UAF0FCR,UAF0FCR_UF0FEN|UAF0FCR_UF0RFR|UAF0FCR_UF0TFR);	// enable hardware FIFO
 	
 	clear_bit(QUAF0);								// clear irq
 	set_bit(EUAF0);									// enable interrupt of UART TX
@@ -261,8 +302,11 @@ void uartf_begin(UINT32 baud)
 	// buffer reset
 	uart_fifo_init(&uartf_tx_fifo);
 	uart_fifo_init(&uartf_rx_fifo);
+	uartf_tx_async.len = 0;
+	uartf_tx_async.done = NULL;
 	// start
 	uartf_tx_flag = false;
+	uart_set_sending(&uartf_tx_sending, false);
 	set_bit(UF0RFR);
 	set_bit(UF0TFR);
 	dummy = read_reg16(UAF0BUF);
@@ -304,6 +348,7 @@ void uart_end(void)
 //	clear_bit(U1EN);						// tx disenable
 	set_bit(DUA0);							// disenable UART0
 	set_bit(DUA1);							// disenable UART0
+	uart_set_sending(&uart_tx_sending, false);
 	return;
 }
 
@@ -313,6 +358,7 @@ void uartf_end(void)
 	clear_bit(EUAF0);						// disenable interrupt of UART RX 
 	clear_bit(QUAF0);						// clear irq
 	set_bit(DUAF0);							// enable UART0
+	uart_set_sending(&uartf_tx_sending, false);
 	return;
 }
 
@@ -328,13 +374,16 @@ int uartf_rx_available(void)
 }
 
 // return available bytes of fifo for tx
+// fifo is not available until asynchronous transmission is completed.
 int uart_tx_available(void)
 {
+	if(uart_tx_async.len != 0) return 0;
 	return (uart_tx_fifo.max_length-uart_tx_fifo.length);
 }
 
 int uartf_tx_available(void)
 {
+	if(uartf_tx_async.len != 0) return 0;
 	return (uartf_tx_fifo.max_length-uartf_tx_fifo.length);
 }
 
@@ -347,16 +396,24 @@ size_t uart_tx_write(char data)
 	
 //	__DI();										// disenable interrupt
 	dis_interrupts(DI_UART);
-	res = uart_fifo_in(&uart_tx_fifo,data);
+	if(uart_tx_async.len != 0)
+	{
+		res = 0;								// wait end of asynchronous transmission
+	}
+	else
+	{
+		res = uart_fifo_in(&uart_tx_fifo,data);
+		if(uart_tx_fifo.length > uart_stats.tx_peak) uart_stats.tx_peak = uart_tx_fifo.length;
+	}
 	
 	if(res == 1)
 	{
 		if(uart_tx_flag == false)
 		{
-			data = (char)uart_fifo_out(&uart_tx_fifo);
+			data = (char)uart_tx_next(&uart_tx_fifo,&uart_tx_async,&uart_stats);
 			write_reg8(UA1BUF,data);
 			uart_tx_flag = true;
-			uart_tx_sending = true;
+			uart_set_sending(&uart_tx_sending, true);
 		}
 	}
 //	__EI();										// enable interrupt
@@ -370,17 +427,24 @@ size_t uartf_tx_write(char data)
 	
 //	__DI();										// disenable interrupt
 	dis_interrupts(DI_UARTF);
-	res = uart_fifo_in(&uartf_tx_fifo,data);
+	if(uartf_tx_async.len != 0)
+	{
+		res = 0;								// wait end of asynchronous transmission
+	}
+	else
+	{
+		res = uart_fifo_in(&uartf_tx_fifo,data);
+		if(uartf_tx_fifo.length > uartf_stats.tx_peak) uartf_stats.tx_peak = uartf_tx_fifo.length;
+	}
 	
 	if(res == 1)
 	{
 		if(uartf_tx_flag == false)
 		{
-			data = (char)uart_fifo_out(&uartf_tx_fifo);
-			write_reg8(UAF0BUF,data);
+			uartf_tx_fill();
 			set_bit(UF0IRQ);
 			uartf_tx_flag = true;
-			uartf_tx_sending = true;
+			uart_set_sending(&uartf_tx_sending, true);
 		}
 	}
 //	__EI();										// enable interrupt
@@ -388,6 +452,64 @@ size_t uartf_tx_write(char data)
 	return res;
 }
 
+// asynchronous binary write
+// data is sent from the buffer directly. buffer must be kept until done is called.
+// char *data = data buffer pointer
+// size_t quantity = data size to be sent
+// void (*done)(void) = called in tx interrupt after last data is set to hardware. NULL is available.
+//                      it is never called from this function even if data is short.
+// return = accepted data size. 0 = previous asynchronous transmission is not completed.
+size_t uart_tx_write_async(char* data, size_t quantity, void (*done)(void))
+{
+	if((data == NULL) || (quantity == 0)) return 0;
+
+	dis_interrupts(DI_UART);
+	if((uart_tx_async.len != 0) || (uart_tx_async.done != NULL))
+	{
+		enb_interrupts(DI_UART);
+		return 0;
+	}
+	uart_tx_async.buf = (const UCHAR *)data;
+	uart_tx_async.len = quantity;
+	uart_tx_async.done = done;
+
+	if(uart_tx_flag == false)
+	{
+		write_reg8(UA1BUF,(char)uart_tx_next(&uart_tx_fifo,&uart_tx_async,&uart_stats));
+		uart_tx_flag = true;
+		uart_set_sending(&uart_tx_sending, true);
+	}
+	enb_interrupts(DI_UART);
+
+	return quantity;
+}
+
+size_t uartf_tx_write_async(char* data, size_t quantity, void (*done)(void))
+{
+	if((data == NULL) || (quantity == 0)) return 0;
+
+	dis_interrupts(DI_UARTF);
+	if((uartf_tx_async.len != 0) || (uartf_tx_async.done != NULL))
+	{
+		enb_interrupts(DI_UARTF);
+		return 0;
+	}
+	uartf_tx_async.buf = (const UCHAR *)data;
+	uartf_tx_async.len = quantity;
+	uartf_tx_async.done = done;
+
+	if(uartf_tx_flag == false)
+	{
+		uartf_tx_fill();
+		set_bit(UF0IRQ);
+		uartf_tx_flag = true;
+		uart_set_sending(&uartf_tx_sending, true);
+	}
+	enb_interrupts(DI_UARTF);
+
+	return quantity;
+}
+
 
 // binary read
 // return = rx data. when the data is minus, fifo is empty.
@@ -426,6 +548,72 @@ void uartf_flush(void)
 	return;
 }
 
+// get contiguous data area in rx fifo without copy
+// char **ptr = pointer to top of received data
+// size_t *len = number of contiguous bytes from *ptr
+// data must be released by uart_rx_consume after reading.
+void uart_rx_peek_span(char** ptr, size_t* len)
+{
+	*len = uart_fifo_peek_span(&uart_rx_fifo,(UCHAR **)ptr);
+}
+
+void uartf_rx_peek_span(char** ptr, size_t* len)
+{
+	*len = uart_fifo_peek_span(&uartf_rx_fifo,(UCHAR **)ptr);
+}
+
+// release data read by uart_rx_peek_span
+// size_t n = number of bytes to be released
+void uart_rx_consume(size_t n)
+{
+	dis_interrupts(DI_UART);
+	uart_fifo_consume(&uart_rx_fifo,n);
+	enb_interrupts(DI_UART);
+}
+
+void uartf_rx_consume(size_t n)
+{
+	dis_interrupts(DI_UARTF);
+	uart_fifo_consume(&uartf_rx_fifo,n);
+	enb_interrupts(DI_UARTF);
+}
+
+// set delimiter of rx data
+// int delim = delimiter charactor such as '\n'. minus value disables delimiter.
+// bool *flag = set to true when delimiter is received or rx fifo becomes full.
+//              it can be passed to wait_event().
+void uart_rx_set_delimiter(int delim, bool *flag)
+{
+	dis_interrupts(DI_UART);
+	uart_rx_delim.flag = flag;
+	uart_rx_delim.delim = (flag == NULL) ? -1 : delim;
+	enb_interrupts(DI_UART);
+}
+
+void uartf_rx_set_delimiter(int delim, bool *flag)
+{
+	dis_interrupts(DI_UARTF);
+	uartf_rx_delim.flag = flag;
+	uartf_rx_delim.delim = (flag == NULL) ? -1 : delim;
+	enb_interrupts(DI_UARTF);
+}
+
+// get statistics of port
+// UART_STATS *stats = pointer to copy statistics
+void uart_get_stats(UART_STATS* stats)
+{
+	dis_interrupts(DI_UART);
+	*stats = uart_stats;
+	enb_interrupts(DI_UART);
+}
+
+void uartf_get_stats(UART_STATS* stats)
+{
+	dis_interrupts(DI_UARTF);
+	*stats = uartf_stats;
+	enb_interrupts(DI_UARTF);
+}
+
 int uart_peek(void)
 {
 	return uart_fifo_out_peek(&uart_rx_fifo);
@@ -442,9 +630,10 @@ void uart_tx_isr(void)
 	int data;
 	if(uart_tx_flag == false)
 	{
-		uart_tx_sending = false;
+		uart_set_sending(&uart_tx_sending, false);
 	}
-	data = uart_fifo_out(&uart_tx_fifo);
+	uart_tx_async_done(&uart_tx_async);
+	data = uart_tx_next(&uart_tx_fifo,&uart_tx_async,&uart_stats);
 	if(data < 0)
 	{
 		uart_tx_flag = false;
@@ -459,7 +648,7 @@ void uart_rx_isr(void)
 {
 	char data;
 	data = read_reg8(UA0BUF);
-	uart_fifo_in(&uart_rx_fifo, data);
+	uart_rx_store(&uart_rx_fifo, &uart_rx_delim, &uart_stats, (UCHAR)data);
 	return;
 }
 
@@ -472,26 +661,28 @@ void uartf_isr(void)
 	{
 	case (3<<1):							// ERROR
 		status = read_reg16(UAF0LSR);
+		if((status & (UAF0LSRL_UF0FER|UAF0LSRL_UF0PER|UAF0LSRL_UF0OER)) != 0)
+		{
+			uartf_stats.rx_error++;
+		}
 		break;
 	case (2<<1):							// READ
 	case (6<<1):							// READ
-		data = read_reg8(UAF0BUF);
-		uart_fifo_in(&uartf_rx_fifo, (unsigned char)data);
+		do {								// read all data in hardware FIFO
+			data = read_reg8(UAF0BUF);
+			uart_rx_store(&uartf_rx_fifo, &uartf_rx_delim, &uartf_stats, (UCHAR)data);
+		} while((read_reg8(UAF0LSR) & UAF0LSRL_UF0DR) != 0);
 		break;
 	case (1<<1):							// SEND
-		data = uart_fifo_out(&uartf_tx_fifo);
 		if(uartf_tx_flag == false)
 		{
-			uart_tx_sending = false;
+			uart_set_sending(&uartf_tx_sending, false);
 		}
-		if(data < 0)
+		uart_tx_async_done(&uartf_tx_async);
+		if(uartf_tx_fill() == 0)			// hardware FIFO is filled up to its depth
 		{
 			uartf_tx_flag = false;
 		}
-		else
-		{
-			write_reg8(UAF0BUF, (char)data);
-		}
 		break;
 	default:
 		//while(1){}
@@ -540,6 +731,73 @@ void uartf_isr(void)
 	return;
 }
 
+// get next tx data. data in fifo is sent before asynchronous buffer
+// return = tx data. when the data is minus, no data to be sent.
+static int uart_tx_next(FIFO_CTRL* fifo_p, UART_TX_ASYNC* async_p, UART_STATS* stats_p)
+{
+	int data;
+
+	data = uart_fifo_out(fifo_p);
+	if((data < 0) && (async_p->len != 0))
+	{
+		data = *async_p->buf;
+		async_p->buf++;
+		async_p->len--;
+	}
+	if(data >= 0) stats_p->tx_bytes++;
+	return data;
+}
+
+// call done of asynchronous transmission when all data was set to hardware.
+// Note: this function shall be called only from tx interrupt, so that next
+//       asynchronous write in done does not write hardware in the middle of filling.
+static void uart_tx_async_done(UART_TX_ASYNC* async_p)
+{
+	void (*done)(void);
+
+	if((async_p->len != 0) || (async_p->done == NULL)) return;
+	done = async_p->done;
+	async_p->done = NULL;							// next asynchronous write is accepted in done
+	done();
+}
+
+// store rx data to fifo and check delimiter
+static void uart_rx_store(FIFO_CTRL* fifo_p, UART_RX_DELIM* delim_p, UART_STATS* stats_p, UCHAR data)
+{
+	stats_p->rx_bytes++;
+	if(uart_fifo_in(fifo_p, data) == 0)
+	{
+		stats_p->rx_overrun++;
+	}
+	else if(fifo_p->length > stats_p->rx_peak)
+	{
+		stats_p->rx_peak = fifo_p->length;
+	}
+	if(delim_p->delim < 0) return;
+	if(((int)data == delim_p->delim) || (fifo_p->length >= fifo_p->max_length))
+	{
+		*delim_p->flag = true;
+	}
+	return;
+}
+
+// fill hardware TX FIFO of UARTF.
+// Note: this function shall be called when TX FIFO is empty
+// return = number of data written to hardware
+static UCHAR uartf_tx_fill(void)
+{
+	UCHAR n;
+	int data;
+
+	for(n = 0; n < UARTF_TX_FIFO_DEPTH; n++)
+	{
+		data = uart_tx_next(&uartf_tx_fifo,&uartf_tx_async,&uartf_stats);
+		if(data < 0) break;
+		write_reg8(UAF0BUF, (char)data);
+	}
+	return n;
+}
+
 //******************************************************************************
 //   FIFO CONTROL for UART
 //******************************************************************************
@@ -577,6 +835,36 @@ volatile int uart_fifo_out_peek(FIFO_CTRL* fifo_p)
 	return fifo_p->buf[fifo_p->rd_p];
 }
 
+// get contiguous data area from read pointer.
+// data in fifo is not changed until uart_fifo_consume is called.
+// return = number of contiguous bytes
+size_t uart_fifo_peek_span(FIFO_CTRL* fifo_p, UCHAR** ptr)
+{
+	UCHAR rd_p = fifo_p->rd_p;
+	UCHAR length = fifo_p->length;			// length is only increased by isr
+	if( length > (UCHAR)(fifo_p->max_length - rd_p))	// area is wrapped
+	{
+		length = fifo_p->max_length - rd_p;
+	}
+	*ptr = &fifo_p->buf[rd_p];
+	return length;
+}
+
+// release data from read pointer.
+// Note: this function shall be called during interrupt is disabled
+void uart_fifo_consume(FIFO_CTRL* fifo_p, size_t n)
+{
+	if( n > fifo_p->length ) n = fifo_p->length;
+	fifo_p->length -= (UCHAR)n;
+	n += fifo_p->rd_p;
+	if( n >= fifo_p->max_length )			// if read pointer reach to maximum, it is wrapped.
+	{
+		n -= fifo_p->max_length;
+	}
+	fifo_p->rd_p = (UCHAR)n;
+	return;
+}
+
 
 // initializing fifo
 void uart_fifo_init(FIFO_CTRL* fifo_p)
@@ -28,7 +28,24 @@
 //********************************************************************************
 //   global definitions
 //********************************************************************************
+// buffer length of each port can be changed by compile option. maximum is 255.
+//   ex) CMPOPT=/DUARTF_RX_BUFFER_LENGTH=255
 #define UART_BUFFER_LENGTH 128
+#ifndef UART_RX_BUFFER_LENGTH
+	#define UART_RX_BUFFER_LENGTH	UART_BUFFER_LENGTH
+#endif
+#ifndef UART_TX_BUFFER_LENGTH
+	#define UART_TX_BUFFER_LENGTH	UART_BUFFER_LENGTH
+#endif
+#ifndef UARTF_RX_BUFFER_LENGTH
+	#define UARTF_RX_BUFFER_LENGTH	UART_BUFFER_LENGTH
+#endif
+#ifndef UARTF_TX_BUFFER_LENGTH
+	#define UARTF_TX_BUFFER_LENGTH	UART_BUFFER_LENGTH
+#endif
+#if (UART_RX_BUFFER_LENGTH > 255) || (UART_TX_BUFFER_LENGTH > 255) || (UARTF_RX_BUFFER_LENGTH > 255) || (UARTF_TX_BUFFER_LENGTH > 255)
+	#error "UART buffer length must be 255 or less"
+#endif
 
 typedef struct {
 	UCHAR max_length;
@@ -38,6 +55,16 @@ typedef struct {
 	UCHAR length;
 } FIFO_CTRL;
 
+// statistics of port. counters are accumulated from reset of MCU.
+typedef struct {
+	UINT32 rx_bytes;			// number of bytes received
+	UINT32 tx_bytes;			// number of bytes sent
+	UINT16 rx_overrun;			// number of bytes lost by rx fifo full
+	UINT16 rx_error;			// number of framing, parity and overrun error of hardware (UARTF only)
+	UCHAR rx_peak;				// peak fill level of rx fifo
+	UCHAR tx_peak;				// peak fill level of tx fifo
+} UART_STATS;
+
 //********************************************************************************
 //   global parameters
 //********************************************************************************
@@ -62,17 +89,29 @@ extern int uartf_rx_available(void);
 extern int uartf_tx_available(void);
 extern size_t uart_tx_write(char data);
 extern size_t uartf_tx_write(char data);
+extern size_t uart_tx_write_async(char* data, size_t quantity, void (*done)(void));
+extern size_t uartf_tx_write_async(char* data, size_t quantity, void (*done)(void));
 extern int uart_rx_read(void);
 extern int uartf_rx_read(void);
 extern void uart_flush(void);
 extern void uartf_flush(void);
 extern int uart_peek(void);
 extern int uartf_peek(void);
+extern void uart_rx_peek_span(char** ptr, size_t* len);
+extern void uartf_rx_peek_span(char** ptr, size_t* len);
+extern void uart_rx_consume(size_t n);
+extern void uartf_rx_consume(size_t n);
+extern void uart_rx_set_delimiter(int delim, bool *flag);
+extern void uartf_rx_set_delimiter(int delim, bool *flag);
+extern void uart_get_stats(UART_STATS* stats);
+extern void uartf_get_stats(UART_STATS* stats);
 
 extern void uart_fifo_init(FIFO_CTRL* fifo_p);
 extern volatile size_t uart_fifo_in(FIFO_CTRL* fifo_p, UCHAR data);
 extern volatile int uart_fifo_out(FIFO_CTRL* fifo_p);
 extern volatile int uart_fifo_out_peek(FIFO_CTRL* fifo_p);
+extern size_t uart_fifo_peek_span(FIFO_CTRL* fifo_p, UCHAR** ptr);
+extern void uart_fifo_consume(FIFO_CTRL* fifo_p, size_t n);
 
 extern void uart_rx_isr(void);
 extern void uartf_isr(void);
@@ -25,10 +25,18 @@
 	#pragma SEGCONST "OTA_SEGCONST"
 #endif
 
+#include "common.h"
 #include "mcu.h"
 #include "rdwr_reg.h"
+#include "driver_irq.h"
 #include "lp_manage.h"
 
+/*############################################################################*/
+/*#                              Variable                                    #*/
+/*############################################################################*/
+static volatile unsigned char   lp_constraint[LP_NEED_NUM];    /* number of votes */
+static LP_RESIDENCY             lp_residency;
+
 /**
  * Setting STOP mode
  *
@@ -99,3 +107,112 @@ void lp_setDeepHaltMode( void )
 	__asm("nop\n");
 }
 
+/**
+ * Take a vote of power constraint
+ *
+ * Drivers take LP_NEED_HSCLK while a transfer clocked by HSCLK is in progress,
+ * and release it by lp_removeConstraint() when it is completed.
+ * Votes are counted, and this function can be called in interrupt handler.
+ *
+ * @param[in]   need    LP_NEED_HSCLK or LP_NEED_LSCLK
+ * @return      None
+ */
+void lp_addConstraint( unsigned char need )
+{
+	if( need >= LP_NEED_NUM ) return;
+	dis_interrupts( DI_LP );
+	lp_constraint[need]++;
+	enb_interrupts( DI_LP );
+}
+
+/**
+ * Release a vote of power constraint
+ *
+ * @param[in]   need    LP_NEED_HSCLK or LP_NEED_LSCLK
+ * @return      None
+ */
+void lp_removeConstraint( unsigned char need )
+{
+	if( need >= LP_NEED_NUM ) return;
+	dis_interrupts( DI_LP );
+	if( lp_constraint[need] != 0 ) {
+		lp_constraint[need]--;
+	}
+	enb_interrupts( DI_LP );
+}
+
+/**
+ * Get the deepest idle mode allowed by current votes
+ *
+ * @param       -
+ * @return      LP_MODE_HALT, LP_MODE_HALTH or LP_MODE_STOP
+ */
+unsigned char lp_getIdleMode( void )
+{
+	if( lp_constraint[LP_NEED_HSCLK] != 0 ) {
+		return LP_MODE_HALT;
+	}
+	if( lp_constraint[LP_NEED_LSCLK] != 0 ) {
+		return LP_MODE_HALTH;
+	}
+	return LP_MODE_STOP;
+}
+
+/**
+ * Idle until the next interrupt in the deepest allowed mode
+ *
+ * Time in the mode is measured by timer 0/1, which runs on LSCLK.
+ * The timer does not count in STOP mode.
+ *
+ * @param       -
+ * @return      None
+ */
+void lp_idle( void )
+{
+	unsigned char mode;
+	unsigned short start;
+
+	mode = lp_getIdleMode();
+	start = read_reg16( TM01C );
+	switch( mode ) {
+	case LP_MODE_HALT:
+		lp_setHaltMode();
+		break;
+	case LP_MODE_HALTH:
+		lp_setHaltHMode();
+		break;
+	default:
+		lp_setStopMode();
+		break;
+	}
+	lp_residency.count[mode]++;
+	lp_residency.ticks[mode] += (unsigned short)( read_reg16( TM01C ) - start );
+}
+
+/**
+ * Get residency counters of idle modes
+ *
+ * @param[out]  res     copy of counters
+ * @return      None
+ */
+void lp_getResidency( LP_RESIDENCY *res )
+{
+	*res = lp_residency;
+}
+
+/**
+ * Clear residency counters of idle modes
+ *
+ * @param       -
+ * @return      None
+ */
+void lp_clrResidency( void )
+{
+	unsigned char i;
+
+	for( i = 0; i < LP_MODE_NUM; i++ ) {
+		lp_residency.count[i] = 0;
+		lp_residency.ticks[i] = 0;
+	}
+}
+
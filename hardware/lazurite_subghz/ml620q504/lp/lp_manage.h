@@ -21,6 +21,29 @@
 #ifndef _LP_MANAGE_H_
 #define _LP_MANAGE_H_
 
+/*############################################################################*/
+/*#                                Definition                                #*/
+/*############################################################################*/
+/* --- Power constraint, voted by drivers --- */
+#define LP_NEED_HSCLK       ( 0 )       /* HSCLK must run in idle (HALT mode)   */
+#define LP_NEED_LSCLK       ( 1 )       /* LSCLK must run in idle (HALT-H mode) */
+#define LP_NEED_NUM         ( 2 )
+
+/* --- Idle mode selected by lp_idle() ---
+ * Lazurite keeps LP_NEED_LSCLK from init() for timer 0/1 of millis(), so that
+ * lp_idle() selects HALT or HALT-H, and STOP is not reached.
+ */
+#define LP_MODE_HALT        ( 0 )
+#define LP_MODE_HALTH       ( 1 )
+#define LP_MODE_STOP        ( 2 )
+#define LP_MODE_NUM         ( 3 )
+
+/* --- Residency of idle modes --- */
+typedef struct {
+	unsigned long   count[LP_MODE_NUM];     /* number of entries                          */
+	unsigned long   ticks[LP_MODE_NUM];     /* time in the mode, LSCLK ticks (timer 0/1)  */
+} LP_RESIDENCY;
+
 /*############################################################################*/
 /*#                                  API                                     #*/
 /*############################################################################*/
@@ -28,6 +51,12 @@ void            lp_setStopMode( void );
 void            lp_setHaltMode( void );
 void            lp_setHaltHMode( void );
 void            lp_setDeepHaltMode( void );
+void            lp_addConstraint( unsigned char need );
+void            lp_removeConstraint( unsigned char need );
+unsigned char   lp_getIdleMode( void );
+void            lp_idle( void );
+void            lp_getResidency( LP_RESIDENCY *res );
+void            lp_clrResidency( void );
 
 #endif /*_LP_MANAGE_H_*/
 
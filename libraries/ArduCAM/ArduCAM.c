@@ -97,6 +97,7 @@ void ArduCAM_write_reg(uint8_t addr, uint8_t data);
 uint8_t ArduCAM_bus_write(int address,int value);
 uint8_t ArduCAM_bus_read(int address);
 int ArduCAM_wrSensorRegs16_8(const struct sensor_reg reglist[]);
+int ArduCAM_wrSensorRegsRLE16_8(const uint8_t *table, bool verify);
 byte ArduCAM_wrSensorReg8_8(uint8_t regID, uint8_t regDat);
 byte ArduCAM_rdSensorReg8_8(uint8_t regID, uint8_t* regDat);
 byte ArduCAM_wrSensorReg8_16(uint8_t regID, int regDat);
@@ -110,6 +111,7 @@ static byte sensor_model = OV7670;
 static byte sensor_addr = 0x42;
 static byte chip_sel;
 static byte m_fmt;
+static const SPISettings arducam_spi = SPI_SETTINGS(SPI_CLOCK_DIV4, MSBFIRST, SPI_MODE0);
 
 void ArduCAM_init(byte model ,int CS)
 {
@@ -234,13 +236,13 @@ void ArduCAM_InitCAM(void)
 			ArduCAM_wrSensorReg16_8(0x3008, 0x80);
 			if (m_fmt == RAW){
 				//Init and set 640x480;
-				ArduCAM_wrSensorRegs16_8(OV5642_1280x960_RAW);	
-				ArduCAM_wrSensorRegs16_8(OV5642_640x480_RAW);	
+				ArduCAM_wrSensorRegsRLE16_8(OV5642_1280x960_RAW, false);	
+				ArduCAM_wrSensorRegsRLE16_8(OV5642_640x480_RAW, false);	
 			} else {
-				ArduCAM_wrSensorRegs16_8(OV5642_QVGA_Preview);
+				ArduCAM_wrSensorRegsRLE16_8(OV5642_QVGA_Preview, false);
 				if (m_fmt == JPEG){
-					ArduCAM_wrSensorRegs16_8(OV5642_JPEG_Capture_QSXGA);
-					ArduCAM_wrSensorRegs16_8(ov5642_320x240);
+					ArduCAM_wrSensorRegsRLE16_8(OV5642_JPEG_Capture_QSXGA, false);
+					ArduCAM_wrSensorRegsRLE16_8(ov5642_320x240, false);
 					ArduCAM_wrSensorReg16_8(0x3818, 0xa8);
 					ArduCAM_wrSensorReg16_8(0x3621, 0x10);
 					ArduCAM_wrSensorReg16_8(0x3801, 0xb0);
@@ -273,10 +275,10 @@ void ArduCAM_InitCAM(void)
 				ArduCAM_wrSensorReg16_8(0x3103, 0x11);
 				ArduCAM_wrSensorReg16_8(0x3008, 0x82);
 				delay(100);
-				ArduCAM_wrSensorRegs16_8(OV5640YUV_Sensor_Dvp_Init);
+				ArduCAM_wrSensorRegsRLE16_8(OV5640YUV_Sensor_Dvp_Init, false);
 				delay(500);
-				ArduCAM_wrSensorRegs16_8(OV5640_JPEG_QSXGA);
-				ArduCAM_wrSensorRegs16_8(OV5640_QSXGA2QVGA);
+				ArduCAM_wrSensorRegsRLE16_8(OV5640_JPEG_QSXGA, false);
+				ArduCAM_wrSensorRegsRLE16_8(OV5640_QSXGA2QVGA, false);
 #if (defined(OV5640_MINI_5MP_PLUS) || (defined(ARDUCAM_SHIELD_V2))
 				ArduCAM_wrSensorReg16_8(0x4407, 0x04);
 #else
@@ -286,8 +288,8 @@ void ArduCAM_InitCAM(void)
 				ArduCAM_wrSensorReg16_8(0x3103, 0x11);
 				ArduCAM_wrSensorReg16_8(0x3008, 0x82);
 				delay(500);
-				ArduCAM_wrSensorRegs16_8(OV5640YUV_Sensor_Dvp_Init);
-				ArduCAM_wrSensorRegs16_8(OV5640_RGB_QVGA);
+				ArduCAM_wrSensorRegsRLE16_8(OV5640YUV_Sensor_Dvp_Init, false);
+				ArduCAM_wrSensorRegsRLE16_8(OV5640_RGB_QVGA, false);
 			}
 #endif
 			break;
@@ -295,7 +297,7 @@ void ArduCAM_InitCAM(void)
 		case OV3640:
 		{
 #if defined(OV3640_CAM)
-			ArduCAM_wrSensorRegs16_8(OV3640_QVGA);
+			ArduCAM_wrSensorRegsRLE16_8(OV3640_QVGA, false);
 #endif
 			break;
 		}
@@ -603,10 +605,12 @@ void ArduCAM_set_fifo_burst(void)
 void ArduCAM_CS_HIGH(void)
 {
 	digitalWrite(chip_sel, HIGH);
+	SPI.endTransaction();
 }
 
 void ArduCAM_CS_LOW(void)
 {
+	SPI.beginTransaction(&arducam_spi);
 	digitalWrite(chip_sel, LOW);
 }
 
@@ -617,6 +621,43 @@ uint8_t ArduCAM_read_fifo(void)
 	return data;
 }
 
+// read len bytes from FIFO by one burst read.
+// FIFO read pointer is kept after CS is high, so next call continues from next byte.
+uint16_t ArduCAM_readFifoBurst(uint8_t *buf, uint16_t len)
+{
+	if(len == 0) return 0;
+	ArduCAM_CS_LOW();
+	ArduCAM_set_fifo_burst();
+	SPI.readInto(buf, len);
+	ArduCAM_CS_HIGH();
+	return len;
+}
+
+// read length bytes of captured image in chunk size, and pass each chunk to sink.
+// CS is high while sink is called, so sink can use SPI bus. (ex. File.write to SD,
+// or SubGHz.send of a frame with chunk = payload size)
+// length = 0 : read_fifo_length() is used
+// sink returns false to stop streaming
+// return = number of bytes passed to sink
+uint32_t ArduCAM_streamFifo(uint8_t *buf, uint16_t chunk, uint32_t length, bool (*sink)(const uint8_t *data, uint16_t len))
+{
+	uint32_t done = 0;
+	uint16_t n;
+
+	if((buf == NULL) || (chunk == 0) || (sink == NULL)) return 0;
+	if(length == 0) length = ArduCAM_read_fifo_length();
+	if(length > MAX_FIFO_SIZE) return 0;
+
+	while(done < length)
+	{
+		n = (length - done > chunk) ? chunk : (uint16_t)(length - done);
+		ArduCAM_readFifoBurst(buf, n);
+		if(!sink(buf, n)) break;
+		done += n;
+	}
+	return done;
+}
+
 uint8_t ArduCAM_read_reg(uint8_t addr)
 {
 	uint8_t data;
@@ -677,22 +718,25 @@ void ArduCAM_set_mode(uint8_t mode)
 
 uint8_t ArduCAM_bus_write(int address,int value)
 {	
+	uint8_t buf[2];
+	buf[0] = (uint8_t)address;
+	buf[1] = (uint8_t)value;
 	ArduCAM_CS_LOW();
-	SPI.transfer((uint8_t)address);
-	SPI.transfer((uint8_t)value);
+	SPI.transferBuffer(buf, NULL, 2);
 	ArduCAM_CS_HIGH();
 	return 1;
 }
 
 uint8_t ArduCAM_bus_read(int address)
 {
-	uint8_t value;
+	uint8_t buf[2];
+	buf[0] = (uint8_t)address;
+	buf[1] = 0x00;
 	ArduCAM_CS_LOW();
-	SPI.transfer((uint8_t)address);
-	value = SPI.transfer(0x00);
+	SPI.transferBuffer(buf, buf, 2);
 	// take the SS pin high to de-select the chip:
 	ArduCAM_CS_HIGH();
-	return value;
+	return buf[1];
 }
 
 void ArduCAM_OV3640_set_JPEG_size(uint8_t size)
@@ -700,34 +744,34 @@ void ArduCAM_OV3640_set_JPEG_size(uint8_t size)
 #if (defined(OV3640_CAM) || defined(OV3640_MINI_2MP))
 	switch(size) {
 		case OV3640_176x144:
-			ArduCAM_wrSensorRegs8_8(OV3640_176x144_JPEG);
+			ArduCAM_wrSensorRegsRLE16_8(OV3640_176x144_JPEG, false);
 			break;
 		case OV3640_320x240:
-			ArduCAM_wrSensorRegs16_8(OV3640_320x240_JPEG);
+			ArduCAM_wrSensorRegsRLE16_8(OV3640_320x240_JPEG, false);
 			break;
 		case OV3640_352x288:
-			ArduCAM_wrSensorRegs16_8(OV3640_352x288_JPEG);
+			ArduCAM_wrSensorRegsRLE16_8(OV3640_352x288_JPEG, false);
 			break;
 		case OV3640_640x480:
-			ArduCAM_wrSensorRegs16_8(OV3640_640x480_JPEG);
+			ArduCAM_wrSensorRegsRLE16_8(OV3640_640x480_JPEG, false);
 			break;
 		case OV3640_800x600:
-			ArduCAM_wrSensorRegs16_8(OV3640_800x600_JPEG);
+			ArduCAM_wrSensorRegsRLE16_8(OV3640_800x600_JPEG, false);
 			break;
 		case OV3640_1024x768:
-			ArduCAM_wrSensorRegs16_8(OV3640_1024x768_JPEG);
+			ArduCAM_wrSensorRegsRLE16_8(OV3640_1024x768_JPEG, false);
 			break;
 		case OV3640_1280x960:
-			ArduCAM_wrSensorRegs16_8(OV3640_1280x960_JPEG);
+			ArduCAM_wrSensorRegsRLE16_8(OV3640_1280x960_JPEG, false);
 			break;
 		case OV3640_1600x1200:
-			ArduCAM_wrSensorRegs16_8(OV3640_1600x1200_JPEG);
+			ArduCAM_wrSensorRegsRLE16_8(OV3640_1600x1200_JPEG, false);
 			break;
 		case OV3640_2048x1536:
-			ArduCAM_wrSensorRegs16_8(OV3640_2048x1536_JPEG);
+			ArduCAM_wrSensorRegsRLE16_8(OV3640_2048x1536_JPEG, false);
 			break;
 		default:
-			ArduCAM_wrSensorRegs16_8(OV3640_320x240_JPEG);
+			ArduCAM_wrSensorRegsRLE16_8(OV3640_320x240_JPEG, false);
 			break;
 	}
 #endif
@@ -776,18 +820,18 @@ void ArduCAM_OV5642_set_RAW_size(uint8_t size)
 #if (defined(OV5642_CAM) || defined(OV5642_CAM_BIT_ROTATION_FIXED)|| defined(OV5642_MINI_5MP) || defined(OV5642_MINI_5MP_PLUS))
 	switch (size) {
 		case OV5642_640x480:
-			ArduCAM_wrSensorRegs16_8(OV5642_1280x960_RAW);	
-			ArduCAM_wrSensorRegs16_8(OV5642_640x480_RAW);	
+			ArduCAM_wrSensorRegsRLE16_8(OV5642_1280x960_RAW, false);	
+			ArduCAM_wrSensorRegsRLE16_8(OV5642_640x480_RAW, false);	
 			break;
 		case OV5642_1280x960:
-			ArduCAM_wrSensorRegs16_8(OV5642_1280x960_RAW);	
+			ArduCAM_wrSensorRegsRLE16_8(OV5642_1280x960_RAW, false);	
 			break;
 		case OV5642_1920x1080:
-			ArduCAM_wrSensorRegs16_8(ov5642_RAW);
-			ArduCAM_wrSensorRegs16_8(OV5642_1920x1080_RAW);
+			ArduCAM_wrSensorRegsRLE16_8(ov5642_RAW, false);
+			ArduCAM_wrSensorRegsRLE16_8(OV5642_1920x1080_RAW, false);
 			break;
 		case OV5642_2592x1944:
-			ArduCAM_wrSensorRegs16_8(ov5642_RAW);
+			ArduCAM_wrSensorRegsRLE16_8(ov5642_RAW, false);
 			break;
 		default:
 			break;
@@ -800,28 +844,28 @@ void ArduCAM_OV5642_set_JPEG_size(uint8_t size)
 #if (defined(OV5642_CAM) || defined(OV5642_CAM_BIT_ROTATION_FIXED)|| defined(OV5642_MINI_5MP) || defined(OV5642_MINI_5MP_PLUS))
 	switch (size) {
 		case OV5642_320x240:
-			ArduCAM_wrSensorRegs16_8(ov5642_320x240);
+			ArduCAM_wrSensorRegsRLE16_8(ov5642_320x240, false);
 			break;
 		case OV5642_640x480:
-			ArduCAM_wrSensorRegs16_8(ov5642_640x480);
+			ArduCAM_wrSensorRegsRLE16_8(ov5642_640x480, false);
 			break;
 		case OV5642_1024x768:
-			ArduCAM_wrSensorRegs16_8(ov5642_1024x768);
+			ArduCAM_wrSensorRegsRLE16_8(ov5642_1024x768, false);
 			break;
 		case OV5642_1280x960:
-			ArduCAM_wrSensorRegs16_8(ov5642_1280x960);
+			ArduCAM_wrSensorRegsRLE16_8(ov5642_1280x960, false);
 			break;
 		case OV5642_1600x1200:
-			ArduCAM_wrSensorRegs16_8(ov5642_1600x1200);
+			ArduCAM_wrSensorRegsRLE16_8(ov5642_1600x1200, false);
 			break;
 		case OV5642_2048x1536:
-			ArduCAM_wrSensorRegs16_8(ov5642_2048x1536);
+			ArduCAM_wrSensorRegsRLE16_8(ov5642_2048x1536, false);
 			break;
 		case OV5642_2592x1944:
-			ArduCAM_wrSensorRegs16_8(ov5642_2592x1944);
+			ArduCAM_wrSensorRegsRLE16_8(ov5642_2592x1944, false);
 			break;
 		default:
-			ArduCAM_wrSensorRegs16_8(ov5642_320x240);
+			ArduCAM_wrSensorRegsRLE16_8(ov5642_320x240, false);
 			break;
 	}
 #endif
@@ -832,35 +876,35 @@ void ArduCAM_OV5640_set_JPEG_size(uint8_t size)
 #if (defined(OV5640_CAM) || defined(OV5640_MINI_5MP_PLUS))
 	switch (size) {
 		case OV5640_320x240:
-			ArduCAM_wrSensorRegs16_8(OV5640_QSXGA2QVGA);
+			ArduCAM_wrSensorRegsRLE16_8(OV5640_QSXGA2QVGA, false);
 			break;
 		case OV5640_352x288:
-			ArduCAM_wrSensorRegs16_8(OV5640_QSXGA2CIF);
+			ArduCAM_wrSensorRegsRLE16_8(OV5640_QSXGA2CIF, false);
 			break;
 		case OV5640_640x480:
-			ArduCAM_wrSensorRegs16_8(OV5640_QSXGA2VGA);
+			ArduCAM_wrSensorRegsRLE16_8(OV5640_QSXGA2VGA, false);
 			break;
 		case OV5640_800x480:
-			ArduCAM_wrSensorRegs16_8(OV5640_QSXGA2WVGA);
+			ArduCAM_wrSensorRegsRLE16_8(OV5640_QSXGA2WVGA, false);
 			break;
 		case OV5640_1024x768:
-			ArduCAM_wrSensorRegs16_8(OV5640_QSXGA2XGA);
+			ArduCAM_wrSensorRegsRLE16_8(OV5640_QSXGA2XGA, false);
 			break;
 		case OV5640_1280x960:
-			ArduCAM_wrSensorRegs16_8(OV5640_QSXGA2SXGA);
+			ArduCAM_wrSensorRegsRLE16_8(OV5640_QSXGA2SXGA, false);
 			break;
 		case OV5640_1600x1200:
-			ArduCAM_wrSensorRegs16_8(OV5640_QSXGA2UXGA);
+			ArduCAM_wrSensorRegsRLE16_8(OV5640_QSXGA2UXGA, false);
 			break;
 		case OV5640_2048x1536:
-			ArduCAM_wrSensorRegs16_8(OV5640_QSXGA2QXGA);
+			ArduCAM_wrSensorRegsRLE16_8(OV5640_QSXGA2QXGA, false);
 			break;
 		case OV5640_2592x1944:
-			ArduCAM_wrSensorRegs16_8(OV5640_JPEG_QSXGA);
+			ArduCAM_wrSensorRegsRLE16_8(OV5640_JPEG_QSXGA, false);
 			break;
 		default:
 			//320x240
-			ArduCAM_wrSensorRegs16_8(OV5640_QSXGA2QVGA);
+			ArduCAM_wrSensorRegsRLE16_8(OV5640_QSXGA2QVGA, false);
 			break;
 	}
 #endif
@@ -2813,6 +2857,69 @@ int ArduCAM_wrSensorRegs16_8(const struct sensor_reg reglist[])
 	return 1;
 }
 
+// Walk a run-length encoded table (see SENSOR_RLE_RUN).
+// write = true : send each run as auto-increment bursts and honor delay markers
+// write = false: read each register back and compare, delay markers are skipped
+// return = number of registers which failed
+static int ArduCAM_walkRLE16_8(const uint8_t *table, bool write)
+{
+	const uint8_t *p = table;
+	uint8_t buf[I2C_BUFFER_LENGTH];
+	uint8_t addr = (uint8_t)(sensor_addr >> 1);
+	int err = 0;
+	uint16_t reg;
+	uint8_t n, i, len, val;
+
+	for (;;)
+	{
+		reg = ((uint16_t)p[0] << 8) | p[1];
+		if (reg == SENSOR_RLE_END_ID) break;
+		if (reg == SENSOR_RLE_DELAY_ID)
+		{
+			if (write) delay(p[2]);
+			p += 3;
+			continue;
+		}
+		n = p[2] & SENSOR_RLE_MAX_RUN;
+		if (write)
+		{
+			// register address (2 bytes) + data must fit into the Wire buffer
+			for (i = 0; i < n; i += len)
+			{
+				len = n - i;
+				if (len > I2C_BUFFER_LENGTH - 2) len = I2C_BUFFER_LENGTH - 2;
+				buf[0] = (uint8_t)((reg + i) >> 8);
+				buf[1] = (uint8_t)((reg + i) & 0xff);
+				memcpy(&buf[2], p + 3 + i, len);
+				Wire.beginTransmission(addr);
+				Wire.write(buf, (size_t)len + 2);
+				if (Wire.endTransmission(true)) err += len;
+			}
+		}
+		else if (!(p[2] & SENSOR_RLE_NO_VERIFY))
+		{
+			for (i = 0; i < n; i++)
+			{
+				buf[0] = (uint8_t)((reg + i) >> 8);
+				buf[1] = (uint8_t)((reg + i) & 0xff);
+				if (Wire.writeRead(addr, buf, 2, &val, 1) || (val != p[3 + i])) err++;
+			}
+		}
+		p += 3 + n;
+	}
+	return err;
+}
+
+// Write a run-length encoded table to 16 bit register address, 8 bit data.
+// verify = true reads all registers back after the table has been written.
+// return = number of registers which could not be written or verified (0 = success)
+int ArduCAM_wrSensorRegsRLE16_8(const uint8_t *table, bool verify)
+{
+	int err = ArduCAM_walkRLE16_8(table, true);
+	if (verify) err += ArduCAM_walkRLE16_8(table, false);
+	return err;
+}
+
 //I2C Array Write 16bit address, 16bit data
 int ArduCAM_wrSensorRegs16_16(const struct sensor_reg reglist[])
 {
@@ -3013,5 +3120,8 @@ const t_ArduCAM ArduCAM = {
 	ArduCAM_wrSensorReg16_8,
 	ArduCAM_rdSensorReg16_8,
 	ArduCAM_wrSensorReg16_16,
-	ArduCAM_rdSensorReg16_16
+	ArduCAM_rdSensorReg16_16,
+	ArduCAM_readFifoBurst,
+	ArduCAM_streamFifo,
+	ArduCAM_wrSensorRegsRLE16_8
 };
\ No newline at end of file
@@ -340,6 +340,24 @@ struct sensor_reg {
 	uint16_t val;
 };
 
+/****************************************************************/
+/* run-length encoded table for 16 bit address, 8 bit data      */
+/*  SENSOR_RLE_RUN(reg, n), d0 ... dn-1 : n consecutive registers */
+/*    starting at reg, written in one auto-increment burst      */
+/*  SENSOR_RLE_RUN_WO(reg, n) : same, skipped by verify pass     */
+/*    (self-clearing reset bits etc.)                            */
+/*  SENSOR_RLE_DELAY(ms) : wait ms before the next record        */
+/*  SENSOR_RLE_END : end of table                                */
+/****************************************************************/
+#define SENSOR_RLE_MAX_RUN		0x7f
+#define SENSOR_RLE_NO_VERIFY	0x80
+#define SENSOR_RLE_DELAY_ID		0xfffe
+#define SENSOR_RLE_END_ID		0xffff
+#define SENSOR_RLE_RUN(reg, n)		(uint8_t)((reg) >> 8), (uint8_t)((reg) & 0xff), (uint8_t)(n)
+#define SENSOR_RLE_RUN_WO(reg, n)	(uint8_t)((reg) >> 8), (uint8_t)((reg) & 0xff), (uint8_t)((n) | SENSOR_RLE_NO_VERIFY)
+#define SENSOR_RLE_DELAY(ms)		0xff, 0xfe, (uint8_t)(ms)
+#define SENSOR_RLE_END				0xff, 0xff
+
 /****************************************************************/
 /* define a structure for sensor register initialization values */
 /****************************************************************/
@@ -412,6 +430,9 @@ typedef struct {
 	byte (*rdSensorReg16_8)(uint16_t regID, uint8_t* regDat); // byte ArduCAM_rdSensorReg16_8(uint16_t regID, uint8_t* regDat)
 	byte (*wrSensorReg16_16)(uint16_t regID, int regDat); // byte ArduCAM_wrSensorReg16_16(uint16_t regID, int regDat)
 	byte (*rdSensorReg16_16)(uint16_t regID, uint16_t* regDat); // byte ArduCAM_rdSensorReg16_16(uint16_t regID, uint16_t* regDat)
+	uint16_t (*readFifoBurst)(uint8_t *buf, uint16_t len); // uint16_t ArduCAM_readFifoBurst(uint8_t *buf, uint16_t len)
+	uint32_t (*streamFifo)(uint8_t *buf, uint16_t chunk, uint32_t length, bool (*sink)(const uint8_t *data, uint16_t len)); // uint32_t ArduCAM_streamFifo(uint8_t *buf, uint16_t chunk, uint32_t length, bool (*sink)(const uint8_t *data, uint16_t len))
+	int (*wrSensorRegsRLE16_8)(const uint8_t *table, bool verify); // int ArduCAM_wrSensorRegsRLE16_8(const uint8_t *table, bool verify)
 } t_ArduCAM;
 
 extern const t_ArduCAM ArduCAM;
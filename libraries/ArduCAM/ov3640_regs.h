@@ -6,388 +6,218 @@
 #define OV3640_CHIPID_LOW 	0x300b
 
 //#include <avr/pgmspace.h>
-const struct sensor_reg OV3640_VGA[] PROGMEM =
+const uint8_t OV3640_VGA[] PROGMEM =
 {
- {0x3012, 0x80},
- {0x3012, 0x80},
- {0x304d, 0x45},
- {0x3087, 0x16},
- {0x30aa, 0x45},
- {0x30b0, 0xff},
- {0x30b1, 0xff},
- {0x30b2, 0x10},
- {0x30d7, 0x10},
- {0x309e, 0x00},
- {0x3602, 0x26},
- {0x3603, 0x4D},
- {0x364c, 0x04},
- {0x360c, 0x12},
- {0x361e, 0x00},
- {0x361f, 0x11},
- {0x3633, 0x32},
- {0x3629, 0x3c},
- {0x300e, 0x32},
- {0x300f, 0x21},
- {0x3010, 0x21},
- {0x3011, 0x00},
- {0x304c, 0x81},
- {0x3018, 0x58},
- {0x3019, 0x59},
- {0x301a, 0x61},
- {0x307d, 0x00},
- {0x3087, 0x02},
- {0x3082, 0x20},
- {0x303c, 0x08},
- {0x303d, 0x18},
- {0x303e, 0x06},
- {0x303F, 0x0c},
- {0x3030, 0x62},
- {0x3031, 0x26},
- {0x3032, 0xe6},
- {0x3033, 0x6e},
- {0x3034, 0xea},
- {0x3035, 0xae},
- {0x3036, 0xa6},
- {0x3037, 0x6a},
- {0x3015, 0x12},
- {0x3014, 0x84},
- {0x3013, 0xf7},
- {0x3104, 0x02},
- {0x3105, 0xfd},
- {0x3106, 0x00},
- {0x3107, 0xff},
- {0x3308, 0xa5},
- {0x3316, 0xff},
- {0x3317, 0x00},
- {0x3087, 0x02},
- {0x3082, 0x20},
- {0x3300, 0x13},
- {0x3301, 0xd6},
- {0x3302, 0xef},
- {0x30b8, 0x20},
- {0x30b9, 0x17},
- {0x30ba, 0x04},
- {0x30bb, 0x08},
- {0x3100, 0x02},
- {0x3304, 0xfc},
- {0x3400, 0x00},
- {0x3404, 0x00},
- {0x3020, 0x01},
- {0x3021, 0x1d},
- {0x3022, 0x00},
- {0x3023, 0x0a},
- {0x3024, 0x08},
- {0x3025, 0x18},
- {0x3026, 0x06},
- {0x3027, 0x0c},
- {0x335f, 0x68},
- {0x3360, 0x18},
- {0x3361, 0x0c},
- {0x3362, 0x68},
- {0x3363, 0x08},
- {0x3364, 0x04},
- {0x3403, 0x42},
- {0x3088, 0x08},
- {0x3089, 0x00},
- {0x308a, 0x06},
- {0x308b, 0x00},
- {0x3507, 0x06},
- {0x350a, 0x4f},
- {0x3600, 0xc4},
- {0x3011, 0x01},
- {0xffff, 0xff},
- 
+ SENSOR_RLE_RUN_WO(0x3012, 1), 0x80,
+ SENSOR_RLE_DELAY(10),
+ SENSOR_RLE_RUN_WO(0x3012, 1), 0x80,
+ SENSOR_RLE_DELAY(10),
+ SENSOR_RLE_RUN(0x304d, 1), 0x45,
+ SENSOR_RLE_RUN(0x3087, 1), 0x16,
+ SENSOR_RLE_RUN(0x30aa, 1), 0x45,
+ SENSOR_RLE_RUN(0x30b0, 3), 0xff, 0xff, 0x10,
+ SENSOR_RLE_RUN(0x30d7, 1), 0x10,
+ SENSOR_RLE_RUN(0x309e, 1), 0x00,
+ SENSOR_RLE_RUN(0x3602, 2), 0x26, 0x4d,
+ SENSOR_RLE_RUN(0x364c, 1), 0x04,
+ SENSOR_RLE_RUN(0x360c, 1), 0x12,
+ SENSOR_RLE_RUN(0x361e, 2), 0x00, 0x11,
+ SENSOR_RLE_RUN(0x3633, 1), 0x32,
+ SENSOR_RLE_RUN(0x3629, 1), 0x3c,
+ SENSOR_RLE_RUN(0x300e, 4), 0x32, 0x21, 0x21, 0x00,
+ SENSOR_RLE_RUN(0x304c, 1), 0x81,
+ SENSOR_RLE_RUN(0x3018, 3), 0x58, 0x59, 0x61,
+ SENSOR_RLE_RUN(0x307d, 1), 0x00,
+ SENSOR_RLE_RUN(0x3087, 1), 0x02,
+ SENSOR_RLE_RUN(0x3082, 1), 0x20,
+ SENSOR_RLE_RUN(0x303c, 4), 0x08, 0x18, 0x06, 0x0c,
+ SENSOR_RLE_RUN(0x3030, 8), 0x62, 0x26, 0xe6, 0x6e, 0xea, 0xae, 0xa6, 0x6a,
+ SENSOR_RLE_RUN(0x3015, 1), 0x12,
+ SENSOR_RLE_RUN(0x3014, 1), 0x84,
+ SENSOR_RLE_RUN(0x3013, 1), 0xf7,
+ SENSOR_RLE_RUN(0x3104, 4), 0x02, 0xfd, 0x00, 0xff,
+ SENSOR_RLE_RUN(0x3308, 1), 0xa5,
+ SENSOR_RLE_RUN(0x3316, 2), 0xff, 0x00,
+ SENSOR_RLE_RUN(0x3087, 1), 0x02,
+ SENSOR_RLE_RUN(0x3082, 1), 0x20,
+ SENSOR_RLE_RUN(0x3300, 3), 0x13, 0xd6, 0xef,
+ SENSOR_RLE_RUN(0x30b8, 4), 0x20, 0x17, 0x04, 0x08,
+ SENSOR_RLE_RUN(0x3100, 1), 0x02,
+ SENSOR_RLE_RUN(0x3304, 1), 0xfc,
+ SENSOR_RLE_RUN(0x3400, 1), 0x00,
+ SENSOR_RLE_RUN(0x3404, 1), 0x00,
+ SENSOR_RLE_RUN(0x3020, 8), 0x01, 0x1d, 0x00, 0x0a, 0x08, 0x18, 0x06, 0x0c,
+ SENSOR_RLE_RUN(0x335f, 6), 0x68, 0x18, 0x0c, 0x68, 0x08, 0x04,
+ SENSOR_RLE_RUN(0x3403, 1), 0x42,
+ SENSOR_RLE_RUN(0x3088, 4), 0x08, 0x00, 0x06, 0x00,
+ SENSOR_RLE_RUN(0x3507, 1), 0x06,
+ SENSOR_RLE_RUN(0x350a, 1), 0x4f,
+ SENSOR_RLE_RUN(0x3600, 1), 0xc4,
+ SENSOR_RLE_RUN(0x3011, 1), 0x01,
+ SENSOR_RLE_END
 };
 
 
 
 
-const struct sensor_reg OV3640_QVGA[] PROGMEM =
+const uint8_t OV3640_QVGA[] PROGMEM =
 {
-	{0x3012, 0x80}, 
-	{0x304d, 0x45}, 
-	{0x30a7, 0x5e}, 
-	{0x3087, 0x16}, 
-	{0x309c, 0x1a}, 
-	{0x30a2, 0xe4}, 
-	{0x30aa, 0x42}, 
-	{0x30b0, 0xff}, 
-	{0x30b1, 0xff}, 
-	{0x30b2, 0x10}, 
-	{0x300e, 0x32}, 
-	{0x300f, 0x21}, 
-	{0x3010, 0x20}, 
-	{0x3011, 0x04}, 
-	{0x304c, 0x81}, 
-	{0x30d7, 0x10}, 
-	{0x30d9, 0x0d}, 
-	{0x30db, 0x08}, 
-	{0x3016, 0x82}, 
-	{0x3018, 0x58}, 
-	{0x3019, 0x59}, 
-	{0x301a, 0x61}, 
-	{0x307d, 0x00}, 
-	{0x3087, 0x02}, 
-	{0x3082, 0x20}, 
-	{0x3015, 0x12}, 
-	{0x3014, 0x84}, 
-	{0x3013, 0xf7}, 
-	{0x303c, 0x08}, 
-	{0x303d, 0x18}, 
-
-	{0x303e, 0x06}, 
-	{0x303f, 0x0c}, 
-	{0x3030, 0x62}, 
-	{0x3031, 0x26}, 
-	{0x3032, 0xe6}, 
-	{0x3033, 0x6e}, 
-	{0x3034, 0xea}, 
-	{0x3035, 0xae}, 
-	{0x3036, 0xa6}, 
-	{0x3037, 0x6a}, 
-	{0x3104, 0x02}, 
-	{0x3105, 0xfd}, 
-	{0x3106, 0x00}, 
-	{0x3107, 0xff}, 
-	{0x3300, 0x12}, 
-	{0x3301, 0xde}, 
-	{0x3302, 0xef}, 
-	{0x3316, 0xff}, 
-	{0x3317, 0x00}, 
-	{0x3312, 0x26}, 
-	{0x3314, 0x42}, 
-	{0x3313, 0x2b}, 
-	{0x3315, 0x42}, 
-	{0x3310, 0xd0}, 
-	{0x3311, 0xbd}, 
-	{0x330c, 0x18}, 
-	{0x330d, 0x18}, 
-	{0x330e, 0x56}, 
-	{0x330f, 0x5c}, 
-	{0x330b, 0x1c}, 
-	{0x3306, 0x5c}, 
-	{0x3307, 0x11}, 
-	{0x336a, 0x52}, 
-	{0x3370, 0x46}, 
-	{0x3376, 0x38}, 
-	{0x3300, 0x13}, 
-	{0x30b8, 0x20}, 
-	{0x30b9, 0x17}, 
-	{0x30ba, 0x4}, 
-	{0x30bb, 0x8}, 
+	SENSOR_RLE_RUN_WO(0x3012, 1), 0x80,
+	SENSOR_RLE_DELAY(10),
+	SENSOR_RLE_RUN(0x304d, 1), 0x45,
+	SENSOR_RLE_RUN(0x30a7, 1), 0x5e,
+	SENSOR_RLE_RUN(0x3087, 1), 0x16,
+	SENSOR_RLE_RUN(0x309c, 1), 0x1a,
+	SENSOR_RLE_RUN(0x30a2, 1), 0xe4,
+	SENSOR_RLE_RUN(0x30aa, 1), 0x42,
+	SENSOR_RLE_RUN(0x30b0, 3), 0xff, 0xff, 0x10,
+	SENSOR_RLE_RUN(0x300e, 4), 0x32, 0x21, 0x20, 0x04,
+	SENSOR_RLE_RUN(0x304c, 1), 0x81,
+	SENSOR_RLE_RUN(0x30d7, 1), 0x10,
+	SENSOR_RLE_RUN(0x30d9, 1), 0x0d,
+	SENSOR_RLE_RUN(0x30db, 1), 0x08,
+	SENSOR_RLE_RUN(0x3016, 1), 0x82,
+	SENSOR_RLE_RUN(0x3018, 3), 0x58, 0x59, 0x61,
+	SENSOR_RLE_RUN(0x307d, 1), 0x00,
+	SENSOR_RLE_RUN(0x3087, 1), 0x02,
+	SENSOR_RLE_RUN(0x3082, 1), 0x20,
+	SENSOR_RLE_RUN(0x3015, 1), 0x12,
+	SENSOR_RLE_RUN(0x3014, 1), 0x84,
+	SENSOR_RLE_RUN(0x3013, 1), 0xf7,
+	SENSOR_RLE_RUN(0x303c, 4), 0x08, 0x18,
+
+	0x06, 0x0c,
+	SENSOR_RLE_RUN(0x3030, 8), 0x62, 0x26, 0xe6, 0x6e, 0xea, 0xae, 0xa6, 0x6a,
+	SENSOR_RLE_RUN(0x3104, 4), 0x02, 0xfd, 0x00, 0xff,
+	SENSOR_RLE_RUN(0x3300, 3), 0x12, 0xde, 0xef,
+	SENSOR_RLE_RUN(0x3316, 2), 0xff, 0x00,
+	SENSOR_RLE_RUN(0x3312, 1), 0x26,
+	SENSOR_RLE_RUN(0x3314, 1), 0x42,
+	SENSOR_RLE_RUN(0x3313, 1), 0x2b,
+	SENSOR_RLE_RUN(0x3315, 1), 0x42,
+	SENSOR_RLE_RUN(0x3310, 2), 0xd0, 0xbd,
+	SENSOR_RLE_RUN(0x330c, 4), 0x18, 0x18, 0x56, 0x5c,
+	SENSOR_RLE_RUN(0x330b, 1), 0x1c,
+	SENSOR_RLE_RUN(0x3306, 2), 0x5c, 0x11,
+	SENSOR_RLE_RUN(0x336a, 1), 0x52,
+	SENSOR_RLE_RUN(0x3370, 1), 0x46,
+	SENSOR_RLE_RUN(0x3376, 1), 0x38,
+	SENSOR_RLE_RUN(0x3300, 1), 0x13,
+	SENSOR_RLE_RUN(0x30b8, 4), 0x20, 0x17, 0x04, 0x08,
+
+	SENSOR_RLE_RUN(0x3507, 1), 0x06,
+	SENSOR_RLE_RUN(0x350a, 1), 0x4f,
+	SENSOR_RLE_RUN(0x3100, 1), 0x02,
+	SENSOR_RLE_RUN(0x3301, 1), 0xde,
+	SENSOR_RLE_RUN(0x3304, 1), 0x00,
+	SENSOR_RLE_RUN(0x3400, 1), 0x01,
+	SENSOR_RLE_RUN(0x3404, 1), 0x11,
+	SENSOR_RLE_RUN(0x335f, 6), 0x68, 0x18, 0x0c, 0x12, 0x88, 0xe4,
+	SENSOR_RLE_RUN(0x3403, 1), 0x42,
+	SENSOR_RLE_RUN(0x3088, 4), 0x02, 0x80, 0x01, 0xe0,
+	SENSOR_RLE_RUN(0x308d, 1), 0x04,
+	SENSOR_RLE_RUN(0x3086, 1), 0x03,
+	SENSOR_RLE_RUN(0x3086, 1), 0x00,
+	SENSOR_RLE_RUN(0x3011, 1), 0x00,
+	SENSOR_RLE_RUN(0x304c, 1), 0x85,
+	SENSOR_RLE_RUN(0x3600, 1), 0xd0,
+	SENSOR_RLE_RUN(0x335f, 6), 0x68, 0x18, 0x0c, 0x01, 0x48, 0xf4,
+	SENSOR_RLE_RUN(0x3403, 1), 0x42,
+	SENSOR_RLE_RUN(0x3088, 4), 0x01, 0x40, 0x00, 0xf0,
+
+	SENSOR_RLE_RUN(0x307c, 1), 0x12,
+	SENSOR_RLE_RUN(0x3090, 1), 0xc8,
 
-	{0x3507, 0x06}, 
-	{0x350a, 0x4f}, 
-	{0x3100, 0x02}, 
-	{0x3301, 0xde}, 
-	{0x3304, 0x00}, 
-	{0x3400, 0x01}, 
-	{0x3404, 0x11}, 
-	{0x335f, 0x68}, 
-	{0x3360, 0x18}, 
-	{0x3361, 0xc}, 
-	{0x3362, 0x12}, 
-	{0x3363, 0x88}, 
-	{0x3364, 0xe4}, 
-	{0x3403, 0x42}, 
-	{0x3088, 0x2}, 
-	{0x3089, 0x80}, 
-	{0x308a, 0x1}, 
-	{0x308b, 0xe0}, 
-	{0x308d, 0x4}, 
-	{0x3086, 0x3}, 
-	{0x3086, 0x0}, 
-	{0x3011, 0x0}, 
-	{0x304c, 0x85}, 
-	{0x3600, 0xd0}, 
-	{0x335f, 0x68}, 
-	{0x3360, 0x18}, 
-	{0x3361, 0xc}, 
-	{0x3362, 0x1}, 
-	{0x3363, 0x48}, 
-	{0x3364, 0xf4}, 
-	{0x3403, 0x42}, 
-	{0x3088, 0x1}, 
-	{0x3089, 0x40}, 
-	{0x308a, 0x0}, 
-	{0x308b, 0xf0}, 
-	
-	{0x307c, 0x12},
-	{0x3090, 0xc8},
-	
 	//{0x3080, 0x02},
 	//{0x307D, 0x80},
 	//{0x306C, 0x10},
-	
-	{0x3600, 0xc4},
-	{0xffff,0xff},
-};
 
-const struct sensor_reg OV3640_176x144_JPEG[] PROGMEM = 
-{
-	{0x335f, 0x68},
-	{0x3360, 0x18},
-	{0x3361, 0x0c},
-	{0x3362, 0x00},
-	{0x3363, 0xb8},
-	{0x3364, 0x94},
-	{0x3403, 0x42},
-	{0x3088, 0x00},
-	{0x3089, 0xb0},
-	{0x308a, 0x00},
-	{0x308b, 0x90},
-	{0x304c, 0x84},
-
-	{0xffff, 0xff},                                                     
+	SENSOR_RLE_RUN(0x3600, 1), 0xc4,
+	SENSOR_RLE_END
 };
 
-const struct sensor_reg OV3640_320x240_JPEG[] PROGMEM =
-{
-	{0x335f, 0x68},
-	{0x3360, 0x18},
-	{0x3361, 0x0c},
-	{0x3362, 0x01},
-	{0x3363, 0x48},
-	{0x3364, 0xf4},
-	{0x3403, 0x42},
-	{0x3088, 0x01},
-	{0x3089, 0x40},
-	{0x308a, 0x00},
-	{0x308b, 0xf0},
-		
-	{0xffff,0xff},
-};   
-
-const struct sensor_reg OV3640_352x288_JPEG[] PROGMEM =
+const uint8_t OV3640_176x144_JPEG[] PROGMEM =
 {
-	{0x3302, 0xef},
-	{0x335f, 0x68},
-	{0x3360, 0x18},
-	{0x3361, 0x0c},
-	{0x3362, 0x11},
-	{0x3363, 0x68},
-	{0x3364, 0x24},
-	{0x3403, 0x42},
-	{0x3088, 0x01},
-	{0x3089, 0x60},
-	{0x308a, 0x01},
-	{0x308b, 0x20},
-	
-	{0xffff,0xff},
+	SENSOR_RLE_RUN(0x335f, 6), 0x68, 0x18, 0x0c, 0x00, 0xb8, 0x94,
+	SENSOR_RLE_RUN(0x3403, 1), 0x42,
+	SENSOR_RLE_RUN(0x3088, 4), 0x00, 0xb0, 0x00, 0x90,
+	SENSOR_RLE_RUN(0x304c, 1), 0x84,
+	SENSOR_RLE_END
 };
 
-
-const struct sensor_reg OV3640_640x480_JPEG[] PROGMEM = 
+const uint8_t OV3640_320x240_JPEG[] PROGMEM =
 {
-	{0x3302, 0xef},
-	{0x335f, 0x68},
-	{0x3360, 0x18},
-	{0x3361, 0x0c},
-	{0x3362, 0x12},
-	{0x3363, 0x88},
-	{0x3364, 0xe4},
-	{0x3403, 0x42},
-	{0x3088, 0x02},
-	{0x3089, 0x80},
-	{0x308a, 0x01},
-	{0x308b, 0xe0},
-	{0x304c, 0x84}, 
-	
-	{0xffff, 0xff},                                                     
+	SENSOR_RLE_RUN(0x335f, 6), 0x68, 0x18, 0x0c, 0x01, 0x48, 0xf4,
+	SENSOR_RLE_RUN(0x3403, 1), 0x42,
+	SENSOR_RLE_RUN(0x3088, 4), 0x01, 0x40, 0x00, 0xf0,
+	SENSOR_RLE_END
 };
- const struct sensor_reg OV3640_800x600_JPEG[] PROGMEM = 
+
+const uint8_t OV3640_352x288_JPEG[] PROGMEM =
 {
-	{0x3302, 0xef},
-	{0x335f, 0x68},
-	{0x3360, 0x18},
-	{0x3361, 0x0c},
-	{0x3362, 0x23},
-	{0x3363, 0x28},
-	{0x3364, 0x5c},
-	{0x3403, 0x42},
-	{0x3088, 0x03},
-	{0x3089, 0x20},
-	{0x308a, 0x02},
-	{0x308b, 0x58},
-	{0x304c, 0x82}, 
-	
-	{0xffff, 0xff},                                                     
+	SENSOR_RLE_RUN(0x3302, 1), 0xef,
+	SENSOR_RLE_RUN(0x335f, 6), 0x68, 0x18, 0x0c, 0x11, 0x68, 0x24,
+	SENSOR_RLE_RUN(0x3403, 1), 0x42,
+	SENSOR_RLE_RUN(0x3088, 4), 0x01, 0x60, 0x01, 0x20,
+	SENSOR_RLE_END
 };
 
- const struct sensor_reg OV3640_1024x768_JPEG[] PROGMEM = 
+
+const uint8_t OV3640_640x480_JPEG[] PROGMEM =
 {
-	{0x3302, 0xef},
-	{0x335f, 0x68},
-	{0x3360, 0x18},
-	{0x3361, 0x0c},
-	{0x3362, 0x34},
-	{0x3363, 0x08},
-	{0x3364, 0x06},
-	{0x3403, 0x42},
-	{0x3088, 0x04},
-	{0x3089, 0x00},
-	{0x308a, 0x03},
-	{0x308b, 0x00},
-	{0x304c, 0x82}, 
-	
-	{0xffff, 0xff},                                                     
+	SENSOR_RLE_RUN(0x3302, 1), 0xef,
+	SENSOR_RLE_RUN(0x335f, 6), 0x68, 0x18, 0x0c, 0x12, 0x88, 0xe4,
+	SENSOR_RLE_RUN(0x3403, 1), 0x42,
+	SENSOR_RLE_RUN(0x3088, 4), 0x02, 0x80, 0x01, 0xe0,
+	SENSOR_RLE_RUN(0x304c, 1), 0x84,
+	SENSOR_RLE_END
 };
+ const uint8_t OV3640_800x600_JPEG[] PROGMEM =
+ {
+	SENSOR_RLE_RUN(0x3302, 1), 0xef,
+	SENSOR_RLE_RUN(0x335f, 6), 0x68, 0x18, 0x0c, 0x23, 0x28, 0x5c,
+	SENSOR_RLE_RUN(0x3403, 1), 0x42,
+	SENSOR_RLE_RUN(0x3088, 4), 0x03, 0x20, 0x02, 0x58,
+	SENSOR_RLE_RUN(0x304c, 1), 0x82,
+	SENSOR_RLE_END
+ };
+
+ const uint8_t OV3640_1024x768_JPEG[] PROGMEM =
+ {
+	SENSOR_RLE_RUN(0x3302, 1), 0xef,
+	SENSOR_RLE_RUN(0x335f, 6), 0x68, 0x18, 0x0c, 0x34, 0x08, 0x06,
+	SENSOR_RLE_RUN(0x3403, 1), 0x42,
+	SENSOR_RLE_RUN(0x3088, 4), 0x04, 0x00, 0x03, 0x00,
+	SENSOR_RLE_RUN(0x304c, 1), 0x82,
+	SENSOR_RLE_END
+ };
  
- const struct sensor_reg OV3640_1600x1200_JPEG[] PROGMEM =     
-{                                                                                                      
-	{0x3302, 0xef},                                           
-	{0x335f, 0x68},                                           
-	{0x3360, 0x18},                                           
-	{0x3361, 0x0C},                                           
-	{0x3362, 0x46},                                           
-	{0x3363, 0x48},                                           
-	{0x3364, 0xb4},                                           
-	{0x3403, 0x42},	
-	{0x3088, 0x06},
-	{0x3089, 0x40},
-	{0x308a, 0x04},
-	{0x308b, 0xb0},
-	{0x304c, 0x85}, 
-	
-	
-	{0xffff, 0xff},
-	                                          
-};    
- const struct sensor_reg OV3640_1280x960_JPEG[] PROGMEM = 
-{
-	{0x3302, 0xef},
-	{0x335f, 0x68},
-	{0x3360, 0x18},
-	{0x3361, 0x0c},
-	{0x3362, 0x35},
-	{0x3363, 0x08},
-	{0x3364, 0xc4},
-	{0x3403, 0x42},
-	{0x3088, 0x05},
-	{0x3089, 0x00},
-	{0x308a, 0x03},
-	{0x308b, 0xc0},
-	{0x304c, 0x81}, 
-	
-	{0xffff, 0xff},                                                     
-};
-
-const struct sensor_reg OV3640_2048x1536_JPEG[] PROGMEM =
+ const uint8_t OV3640_1600x1200_JPEG[] PROGMEM =
+ {
+	SENSOR_RLE_RUN(0x3302, 1), 0xef,
+	SENSOR_RLE_RUN(0x335f, 6), 0x68, 0x18, 0x0c, 0x46, 0x48, 0xb4,
+	SENSOR_RLE_RUN(0x3403, 1), 0x42,
+	SENSOR_RLE_RUN(0x3088, 4), 0x06, 0x40, 0x04, 0xb0,
+	SENSOR_RLE_RUN(0x304c, 1), 0x85,
+	SENSOR_RLE_END
+ };
+ const uint8_t OV3640_1280x960_JPEG[] PROGMEM =
+ {
+	SENSOR_RLE_RUN(0x3302, 1), 0xef,
+	SENSOR_RLE_RUN(0x335f, 6), 0x68, 0x18, 0x0c, 0x35, 0x08, 0xc4,
+	SENSOR_RLE_RUN(0x3403, 1), 0x42,
+	SENSOR_RLE_RUN(0x3088, 4), 0x05, 0x00, 0x03, 0xc0,
+	SENSOR_RLE_RUN(0x304c, 1), 0x81,
+	SENSOR_RLE_END
+ };
+
+const uint8_t OV3640_2048x1536_JPEG[] PROGMEM =
 {
-	{0x3302, 0xef},
-	{0x335f, 0x68},
-	{0x3360, 0x18},
-	{0x3361, 0x0c},
-	{0x3362, 0x68},
-	{0x3363, 0x08},
-	{0x3364, 0x04},
-	{0x3403, 0x42},
-	{0x3088, 0x08},
-	{0x3089, 0x00},
-	{0x308a, 0x06},
-	{0x308b, 0x00},
-	
-	{0xffff,0xff},
+	SENSOR_RLE_RUN(0x3302, 1), 0xef,
+	SENSOR_RLE_RUN(0x335f, 6), 0x68, 0x18, 0x0c, 0x68, 0x08, 0x04,
+	SENSOR_RLE_RUN(0x3403, 1), 0x42,
+	SENSOR_RLE_RUN(0x3088, 4), 0x08, 0x00, 0x06, 0x00,
+	SENSOR_RLE_END
 };
 
 #endif
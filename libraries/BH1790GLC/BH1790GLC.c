@@ -111,23 +111,10 @@ static byte bh1790glc_write(unsigned char memory_address, unsigned char *data, u
 static byte bh1790glc_read(unsigned char memory_address, unsigned char *data, int size)
 {
   byte rc;
-  unsigned char cnt;
 
-  Wire.beginTransmission(BH1790GLC_DEVICE_ADDRESS);
-  Wire.write_byte(memory_address);
-  rc = Wire.endTransmission(false);
-  if (rc != 0) {
-    return (rc);
-  }
-
-  Wire.requestFrom(BH1790GLC_DEVICE_ADDRESS, size, true);
-  cnt = 0;
-  while(Wire.available()) {
-    data[cnt] = Wire.read();
-    cnt++;
-  }
+  rc = Wire.writeRead(BH1790GLC_DEVICE_ADDRESS, &memory_address, 1, data, size);
 
-  return (0);
+  return (rc);
 }
 
 const f_BH1790GLC bh1790glc =
@@ -33,6 +33,8 @@ static void spiStatusRegWrite(uint8_t data_write);
 static uint8_t spiStatusRegRead(void);
 static void _feram_wr_ena(void);
 static void _feram_wr_dis(void);
+static void _feram_cs_low(void);
+static void _feram_cs_high(void);
 
 // SPI can be used from Lazurite connector
 const FERAMClass FeRAM =
@@ -65,6 +67,7 @@ const FERAMClass FeRAM =
 static uint8_t feram_cs;
 static uint8_t feram_wp; 
 static uint8_t feram_hold;
+static const SPISettings feram_spi = SPI_SETTINGS(SPI_CLOCK_DIV4, MSBFIRST, SPI_MODE0);
 
 //********************************************************************************
 //   local function definitions
@@ -94,7 +97,7 @@ static void spiWrite(uint32_t addr, uint8_t data_write)
 {
 	_feram_wr_ena();
 	/*--- CS Low ---*/
-	digitalWrite(feram_cs, LOW);
+	_feram_cs_low();
 	/*--- Command ---*/
 	SPI.transfer(FERAM_CMD_WRITE);
 	/*--- Address ---*/
@@ -104,14 +107,14 @@ static void spiWrite(uint32_t addr, uint8_t data_write)
 	/*--- Data ---*/
 	SPI.transfer(data_write);
 	/*--- CS High ---*/
-	digitalWrite(feram_cs, HIGH);
+	_feram_cs_high();
 }
 
 static uint8_t spiRead(uint32_t addr)
 {
 	uint8_t ret;
 	/*--- CS Low ---*/
-	digitalWrite(feram_cs, LOW);
+	_feram_cs_low();
 	/*--- Command ---*/
 	SPI.transfer(FERAM_CMD_READ);
 	/*--- Address ---*/
@@ -121,7 +124,7 @@ static uint8_t spiRead(uint32_t addr)
 	/*--- Data ---*/
 	ret = SPI.transfer(DMY_DATA);
 	/*--- CS High ---*/
-	digitalWrite(feram_cs, HIGH);
+	_feram_cs_high();
 	return ret;
 }
 
@@ -131,7 +134,7 @@ static void spiBurstWrite(uint32_t addr, uint8_t *data_write_ptr, uint32_t total
 	
 	_feram_wr_ena();
 	/*--- CS Low ---*/
-	digitalWrite(feram_cs, LOW);
+	_feram_cs_low();
 	/*--- Command ---*/
 	SPI.transfer(FERAM_CMD_WRITE);
 	/*--- Address ---*/
@@ -139,11 +142,12 @@ static void spiBurstWrite(uint32_t addr, uint8_t *data_write_ptr, uint32_t total
 	SPI.transfer((unsigned char)(addr>>8 & 0xFF));
 	SPI.transfer((unsigned char)(addr & 0xFF));
 	/*--- Data ---*/
-	for(n = 0; n < total_data_count; n++){
-		SPI.transfer(*(data_write_ptr + n));
+	for(n = 0; n < total_data_count; n += 0x8000){
+		SPI.transferBuffer(data_write_ptr + n, NULL,
+			(uint16_t)((total_data_count - n > 0x8000) ? 0x8000 : (total_data_count - n)));
 	}
 	/*--- CS High ---*/
-	digitalWrite(feram_cs, HIGH);
+	_feram_cs_high();
 }
 	
 static void spiBurstRead(uint32_t addr, uint8_t *data_read_ptr, uint32_t total_data_count )
@@ -151,7 +155,7 @@ static void spiBurstRead(uint32_t addr, uint8_t *data_read_ptr, uint32_t total_d
 	uint32_t n;
 
 	/*--- CS Low ---*/
-	digitalWrite(feram_cs, LOW);
+	_feram_cs_low();
 	/*--- Command ---*/
 	SPI.transfer(FERAM_CMD_READ);
 	/*--- Address ---*/
@@ -159,41 +163,55 @@ static void spiBurstRead(uint32_t addr, uint8_t *data_read_ptr, uint32_t total_d
 	SPI.transfer((unsigned char)(addr>>8 & 0xFF));
 	SPI.transfer((unsigned char)(addr & 0xFF));
 	/*--- Data ---*/
-	for(n = 0; n < total_data_count; n++){
-		*(data_read_ptr + n) = SPI.transfer(DMY_DATA);
+	for(n = 0; n < total_data_count; n += 0x8000){
+		SPI.readInto(data_read_ptr + n,
+			(uint16_t)((total_data_count - n > 0x8000) ? 0x8000 : (total_data_count - n)));
 	}
 	/*--- CS High ---*/
-	digitalWrite(feram_cs, HIGH);
+	_feram_cs_high();
 }
 
 static void spiStatusRegWrite(uint8_t data_write)
 {
-	digitalWrite(feram_cs, LOW);
+	_feram_cs_low();
 	SPI.transfer(FERAM_CMD_RDSR);
 	SPI.transfer(data_write);
-	digitalWrite(feram_cs, HIGH);
+	_feram_cs_high();
 }
 
 static uint8_t spiStatusRegRead(void)
 {
 	uint8_t ret;
-	digitalWrite(feram_cs, LOW);
+	_feram_cs_low();
 	SPI.transfer(FERAM_CMD_RDSR);
 	ret = SPI.transfer(DMY_DATA);
-	digitalWrite(feram_cs, HIGH);
+	_feram_cs_high();
 	return ret;
 }
 	
 static void _feram_wr_ena(void)
 {
-	digitalWrite(feram_cs, LOW);
+	_feram_cs_low();
 	SPI.transfer(FERAM_CMD_WREN);
-	digitalWrite(feram_cs, HIGH);
+	_feram_cs_high();
 }
 
 static void _feram_wr_dis(void)
 {
-	digitalWrite(feram_cs, LOW);
+	_feram_cs_low();
 	SPI.transfer(FERAM_CMD_WRDI);
+	_feram_cs_high();
+}
+
+// hold SPI bus with settings of FeRAM and select the device
+static void _feram_cs_low(void)
+{
+	SPI.beginTransaction(&feram_spi);
+	digitalWrite(feram_cs, LOW);
+}
+
+static void _feram_cs_high(void)
+{
 	digitalWrite(feram_cs, HIGH);
+	SPI.endTransaction();
 }
@@ -191,7 +191,7 @@ static void break_reg_check(uint8_t dev, uint8_t addr);
 /*############################################################################*/
 static uint8_t _i2c_read(uint8_t dev, uint8_t addr, uint8_t* data, uint8_t size)
 {
-	uint8_t slave_addr, res, i=0;
+	uint8_t slave_addr;
 
 	if (dev == LSM9DS1_DEV_XLG) {
 		slave_addr = _slave_addr_xlg;
@@ -201,18 +201,7 @@ static uint8_t _i2c_read(uint8_t dev, uint8_t addr, uint8_t* data, uint8_t size)
 		return I2C_RESULT_ERROR;
 	}
 
-	Wire.beginTransmission(slave_addr);
-	Wire.write_byte((uint8_t)addr);
-	res = Wire.endTransmission(false);
-	if (res == I2C_RESULT_OK) {
-		Wire.requestFrom(slave_addr, size, true);
-		while (Wire.available())
-		{
-			data[i] = (uint8_t)Wire.read();
-			i++;
-		}
-	}
-	return res;
+	return Wire.writeRead(slave_addr, &addr, 1, data, size);
 }
 
 static uint8_t _i2c_write(uint8_t dev, uint8_t addr, uint8_t* data, uint8_t size)
@@ -204,31 +204,14 @@ void writeByte(uint8_t address, uint8_t subAddress, uint8_t data)
 
 uint8_t readByte(uint8_t address, uint8_t subAddress)
 {
-	uint8_t data; // `data` will store the register data	 
-	Wire.beginTransmission(address);         // Initialize the Tx buffer
-	Wire.write_byte(subAddress);	                 // Put slave register address in Tx buffer
-//	Wire.endTransmission(I2C_NOSTOP);        // Send the Tx buffer, but send a restart to keep connection alive
-	Wire.endTransmission(false);             // Send the Tx buffer, but send a restart to keep connection alive
-//	Wire.requestFrom(address, 1);  // Read one byte from slave register address 
-	Wire.requestFrom(address, (size_t) 1,true);  // Read one byte from slave register address 
-	data = (uint8_t)Wire.read();                      // Fill Rx buffer with result
+	uint8_t data = 0; // `data` will store the register data	 
+	Wire.writeRead(address, &subAddress, 1, &data, 1);	// write register address and read one byte by repeated start
 	return data;                             // Return data read from slave register
 }
 
 void readBytes(uint8_t address, uint8_t subAddress, uint8_t count, uint8_t * dest)
 {
-	uint8_t i = 0;
-
-	Wire.beginTransmission(address);   // Initialize the Tx buffer
-	Wire.write_byte(subAddress);            // Put slave register address in Tx buffer
-	Wire.endTransmission(false);  // Send the Tx buffer, but send a restart to keep connection alive
-//	Wire.endTransmission(false);       // Send the Tx buffer, but send a restart to keep connection alive
-//        Wire.requestFrom(address, count);  // Read bytes from slave register address 
-	Wire.requestFrom(address, count,true);  // Read bytes from slave register address 
-	while (Wire.available())
-	{
-		dest[i++] = (uint8_t)Wire.read();
-	}         // Put read results in the Rx buffer
+	Wire.writeRead(address, &subAddress, 1, dest, count);	// write register address and read bytes by repeated start
 }
 
 void initMPU9250()
@@ -21,100 +21,38 @@
 #include "MsTimer2.h"
 #include "driver_timer.h"
 
-void ms_timer2_init(void)
-{
-	timer2.current_time_h = 0;
-	TM23D = (timer2.target_time_h ? 0xFFFF : timer2.target_time_l);
-	return;
-}
+// MsTimer2 runs on swtimer, so timer 2/3 is not used any more.
+static SW_TIMER ms_timer2_swtimer;
+static unsigned long ms_timer2_period;
 
-void ms_timer2_isr()
+static void ms_timer2_func(SW_TIMER *timer)
 {
-	unsigned short tm_count;
-	if(timer2.current_time_h >= timer2.target_time_h)
-	{
-		timer2.callback();
-		ms_timer2_init();
-	}
-	else
-	{
-		timer2.current_time_h++;
-		TM23D = ((timer2.current_time_h != timer2.target_time_h) ?0xFFFF : timer2.target_time_l);
-		QTM3 = 0;
-		tm_count = TM23C;
-		if(timer2.target_time_l < tm_count)
-		{
-			QTM2 = 1;
-		}
-	}
+	if(timer2.callback) timer2.callback();
 }
 
 void ms_timer2_set(unsigned long ms, void (*f)())
 {
-	// calcurate count number of target time
-//	double ms_float;
-	unsigned long tmp_target_time_l;
-	unsigned short tm_data;
-	
 	if(ms == 0) return;
 
-//	ms_float = ms;
-//	ms_float = ms_float * F_LSCLK / 32000 + 0.5;
-
-//	timer2.target_time_h = (unsigned long)(ms_float / 65536);
-//	if(ms_float > 4294967295) 
-//	{
-//		ms_float -= 4294967295;
-//		ms_float -= 1;
-//	}
-//	timer2.target_time_l = (unsigned short)ms_float;	// 
-	timer2.target_time_h = ms / 64000;
-	tmp_target_time_l = ((ms % 64000) <<8) / 250;
-	timer2.target_time_l = (unsigned short)tmp_target_time_l;
-	if(tmp_target_time_l==0)
-	{
-		timer2.target_time_l=0xFFFF;
-		timer2.target_time_h--;
-	}
-	else
-	{
-		timer2.target_time_l--;								// decrease 1 to set register
-	}
-	
-	tm_data = timer2.target_time_h ? 0xFFFF:timer2.target_time_l;
-
-#if 0
-	Serial.print_long(timer2.target_time_h,DEC);
-	Serial.print("\t");
-	Serial.print_long(timer2.target_time_l,DEC);
-	Serial.println("");
-#endif
-	ms_timer2_init();
+	swtimer_stop(&ms_timer2_swtimer);
+	ms_timer2_period = ms;
 	timer2.callback = f;
 
-	// setting timer
-	timer_16bit_set(2,0x68, tm_data, ms_timer2_isr);
-
 	return;
 }
 
 void ms_timer2_start(void)
 {
-	timer_16bit_start(2);
+	if(ms_timer2_period == 0) return;
+	swtimer_start(&ms_timer2_swtimer, ms_timer2_period, ms_timer2_period, ms_timer2_func);
 }
 
 void ms_timer2_stop(void)
 {
-	timer_16bit_stop(2);
+	swtimer_stop(&ms_timer2_swtimer);
 }
 
-extern char uart_tx_sending;
-extern char uartf_tx_sending;
-
 MsTimer2 timer2 ={
-	0,					// unsigned long  current_time_h;
-	0,					// unsigned long  target_time_h;
-	0,					// unsigned short target_time_l;
 	NULL,				// void (*callback)(void);
 	ms_timer2_set,		// void (*set)(unsigned long ms, void (*f)());
 	ms_timer2_start,	// void (*start)(void);
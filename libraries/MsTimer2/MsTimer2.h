@@ -30,9 +30,6 @@
 //   global definitions
 //********************************************************************************
 typedef struct {
-	unsigned long  current_time_h;
-	unsigned long  target_time_h;
-	unsigned short target_time_l;
 	void (*callback)(void);
 	void (*set)(unsigned long ms, void (*f)());
 	void (*start)(void);
@@ -40,22 +40,9 @@ byte RPR0521RS_write(unsigned char memory_address, unsigned char *data, unsigned
 byte RPR0521RS_read(unsigned char memory_address, unsigned char *data, int size)
 {
   byte rc;
-  unsigned char cnt;
- 
-  Wire.beginTransmission(RPR0521RS_DEVICE_ADDRESS);
-  Wire.write_byte(memory_address);
-  rc = Wire.endTransmission(false);
-  if (rc != 0) {
-    return (rc);
-  }
 
-  Wire.requestFrom(RPR0521RS_DEVICE_ADDRESS, size, false);
-  cnt = 0;
-  while(Wire.available()) {
-    data[cnt] = Wire.read();
-    cnt++;
-  }
-  rc = Wire.endTransmission(true);
+  rc = Wire.writeRead(RPR0521RS_DEVICE_ADDRESS, &memory_address, 1, data, size);
+
   return (rc);
 }
 
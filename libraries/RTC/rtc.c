@@ -100,7 +100,7 @@ static tRtcTime _rtc_timePrm = { 0, 0, 0, RTC_WEEK_DAY_SUN, 1, 1, 17 }; // 0:0:0
 /*--- Parameter of alarm. ---*/
 static tRtcAlarm _rtc_timePrm_Alarm = { (void*)0, RTC_SEC_INVALID, \
        RTC_MIN_INVALID, RTC_HOUR_INVALID, RTC_DAY_INVALID, RTC_MON_INVALID, RTC_YEAR_INVALID };
-static _rtc_alarmMatch = MATCH_NONE;
+static uint8_t _rtc_alarmMatch = MATCH_NONE;
 
 /*############################################################################*/
 /*#                               Prototype                                  #*/
@@ -95,7 +95,7 @@ int File_peek(st_File_v *v) {
 size_t File_print(st_File_v *v, const uint8_t *buf) {
   size_t t = 0;
 
-  while (*buf != NULL) {
+  while (*buf != '\0') {
     File_write(v, buf, 1);
     buf++;
     t++;
@@ -114,9 +114,9 @@ size_t File_println(st_File_v *v, const uint8_t *buf) {
 }
 
 // buffered read for more efficient, high speed reading
-int File_read(st_File_v *v, uint8_t *buf, uint16_t nbyte) {
+int File_read(st_File_v *v, void *buf, uint16_t nbyte) {
   if (v->_file) 
-    return SdFile_read(v->_file, buf, nbyte);
+    return SdFile_read(v->_file, (uint8_t*)buf, nbyte);
   return 0;
 }
 
@@ -360,10 +360,61 @@ error.
   }
 
   if (mode & (O_APPEND | O_WRITE)) 
-    SdFile_seekSet(&file, v->_file->fileSize_);
+    SdFile_seekSet(&file, file.fileSize_);
   return File_File_SdFile(v, &file, filepath);
 }
 
+boolean SD_createContiguous(const char *filepath, uint32_t size, st_File_v *v) {
+/*
+
+Create a new file which has `size` bytes of contiguous clusters, and
+open it for writing in raw-append mode.
+
+While the file is smaller than `size`, write() goes straight to the
+consecutive blocks without FAT and directory access. The directory
+entry is updated by flush() and close(). close() releases the clusters
+which are not written.
+
+Fails if the file already exists.
+
+*/
+
+  int pathidx;
+  st_SdFile_v file, parentdir;
+  boolean result;
+
+  SdFile_init(&file);       // constructor, do not forget!
+  SdFile_init(&parentdir);  // constructor, do not forget!
+
+  parentdir = SD_getParentDir(filepath, &pathidx);
+  filepath += pathidx;
+
+  // failed to open a subdir or no file name
+  if (!filepath[0] || !SdFile_isOpen(&parentdir))
+    return File_File(v);
+
+  // there is a special case for the Root directory since its a static dir
+  if (SdFile_isRoot(&parentdir)) {
+    result = SdFile_createContiguous(&file, &root, filepath, size);
+  } else {
+    result = SdFile_createContiguous(&file, &parentdir, filepath, size);
+    SdFile_close(&parentdir);
+  }
+  if (!result) return File_File(v);
+  return File_File_SdFile(v, &file, filepath);
+}
+
+void SD_cacheStats(uint32_t *hit, uint32_t *miss) {
+/*
+
+Get the number of block accesses found in the cache (hit) and the
+number of blocks read from the card by cache misses (miss).
+The counters are cleared by begin().
+
+*/
+  SdVolume_cacheStats(&volume, hit, miss);
+}
+
 boolean SD_exists(const char *filepath) {
 /*
 
@@ -399,6 +450,16 @@ boolean SD_remove(const char *filepath) {
   return SD_walkPath(filepath, &root, SD_callback_remove);
 }
 
+void SD_setStreaming(boolean enable) {
+/*
+
+Use multiple block read/write (CMD18/CMD25) for sequential blocks.
+Enabled by begin(). Call after begin() to disable it.
+
+*/
+  Sd2Card_setStreaming(&card, enable);
+}
+
 
 boolean SD_getNextPathComponent(const char *path, unsigned int *p_offset, char *buffer) {
   /*
@@ -652,6 +713,9 @@ const st_SD_f SD = {
   SD_mkdir,
   SD_remove,
   SD_open,
-  SD_rmdir
+  SD_rmdir,
+  SD_setStreaming,
+  SD_createContiguous,
+  SD_cacheStats
 };
 
@@ -67,7 +67,7 @@ size_t   File_print(st_File_v *v, const uint8_t *buf);
 size_t   File_println(st_File_v *v, const uint8_t *buf);
 boolean  File_seek(st_File_v *v, uint32_t pos);
 uint32_t File_size(st_File_v *v);
-int      File_read(st_File_v *v, uint8_t *buf, uint16_t nbyte);
+int      File_read(st_File_v *v, void *buf, uint16_t nbyte);
 size_t   File_write(st_File_v *v, const uint8_t *buf, size_t size);
 boolean  File_isDirectory(st_File_v *v);
 boolean  File_openNextFile(st_File_v *v, st_File_v *ret, uint8_t mode);
@@ -82,6 +82,9 @@ typedef struct {
   boolean (*remove)(const char *filepath);
   boolean (*open)(const char *filepath, uint8_t mode, st_File_v *v);
   boolean (*rmdir)(const char *filepath);
+  void    (*setStreaming)(boolean enable);
+  boolean (*createContiguous)(const char *filepath, uint32_t size, st_File_v *v);
+  void    (*cacheStats)(uint32_t *hit, uint32_t *miss);
 } st_SD_f;
 
 // "SD" class global object
@@ -112,6 +115,9 @@ boolean SD_rmdir(const char *filepath);
 boolean SD_open(const char *filepath, uint8_t mode, st_File_v *v);
 boolean SD_rmdir(const char *filepath);
 boolean SD_remove(const char *filepath);
+void    SD_setStreaming(boolean enable);
+boolean SD_createContiguous(const char *filepath, uint32_t size, st_File_v *v);
+void    SD_cacheStats(uint32_t *hit, uint32_t *miss);
 
 extern st_Sd2Card_v  card;
 extern st_SdVolume_v volume;
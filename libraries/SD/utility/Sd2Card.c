@@ -39,6 +39,11 @@ static uint8_t Sd2Card_spiRec(void) {
   return SDCARD_SPI.transfer(0xFF);
 }
 //------------------------------------------------------------------------------
+/** Receive bytes from the card. dst may be NULL to skip bytes */
+static void Sd2Card_spiRead(uint8_t* dst, uint16_t count) {
+  SDCARD_SPI.transferBuffer(NULL, dst, count);
+}
+//------------------------------------------------------------------------------
 uint8_t Sd2Card_cardAcmd(st_Sd2Card_v *v, uint8_t cmd, uint32_t arg) {
   Sd2Card_cardCommand(v, CMD55, (uint32_t)0);
   return Sd2Card_cardCommand(v, cmd, arg);
@@ -52,6 +57,9 @@ uint8_t Sd2Card_cardCommand(st_Sd2Card_v *v, uint8_t cmd, uint32_t arg) {
   // end read if in partialBlockRead mode
   Sd2Card_readEnd(v);
 
+  // end multiple block read or write
+  Sd2Card_streamStop(v);
+
   // select card
   Sd2Card_chipSelectLow(v);
 
@@ -69,6 +77,9 @@ uint8_t Sd2Card_cardCommand(st_Sd2Card_v *v, uint8_t cmd, uint32_t arg) {
   if (cmd == CMD8) crc = 0x87;  // correct crc for CMD8 with arg 0x1AA
   Sd2Card_spiSend(crc);
 
+  // discard stuff byte of CMD12. it is data of the stopped read and may look like R1
+  if (cmd == CMD12) Sd2Card_spiRec();
+
   // wait for response
   for (i = 0; ((v->status_ = Sd2Card_spiRec()) & 0x80) && (i != 0xFF); i++);
 
@@ -79,10 +90,12 @@ uint8_t Sd2Card_cardCommand(st_Sd2Card_v *v, uint8_t cmd, uint32_t arg) {
 #pragma INLINE Sd2Card_chipSelectHigh
 void Sd2Card_chipSelectHigh(st_Sd2Card_v *v) {
   digitalWrite(v->chipSelectPin_, HIGH);
+  SDCARD_SPI.endTransaction();
 }
 //------------------------------------------------------------------------------
 #pragma INLINE Sd2Card_chipSelectLow
 void Sd2Card_chipSelectLow(st_Sd2Card_v *v) {
+  SDCARD_SPI.beginTransaction(&v->spiSettings_);
   digitalWrite(v->chipSelectPin_, LOW);
 }
 //------------------------------------------------------------------------------
@@ -105,7 +118,12 @@ boolean Sd2Card_init(st_Sd2Card_v *v, uint8_t sckRateID, uint8_t chipSelectPin)
   uint32_t arg;
 
   v->errorCode_ = v->inBlock_ = v->partialBlockRead_ = v->type_ = 0;
+  v->stream_ = SD_STREAM_NONE;
+  v->streamEnable_ = true;
+  v->lastBlock_ = 0xFFFFFFFF;
   v->chipSelectPin_ = chipSelectPin;
+  v->spiSettings_.brr = sckRateID;
+  v->spiSettings_.ctrl = SPI_MSBFIRST | SPI_MODE0;
   // 16-bit init start time allows over a minute
   t0 = (uint16_t)millis();
 
@@ -196,12 +214,20 @@ uint8_t Sd2Card_readBlock(st_Sd2Card_v *v, uint32_t block, uint8_t* dst) {
  */
 uint8_t Sd2Card_readData(st_Sd2Card_v *v, uint32_t block,
         uint16_t offset, uint16_t count, uint8_t* dst) {
-  uint16_t i;
-
   if (count == 0) return true;
   if ((count + offset) > 512) {
     goto fail;
   }
+  if (offset == 0 && count == 512 && !v->inBlock_) {
+    // switch to multiple block read if blocks are read sequentially
+    if (block == v->lastBlock_ + 1) {
+      if (!Sd2Card_readStart(v, block)) goto fail;
+    }
+    if (v->stream_ == SD_STREAM_READ && block == v->streamBlock_) {
+      return Sd2Card_readNext(v, dst);
+    }
+    v->lastBlock_ = block;
+  }
   if (!v->inBlock_ || block != v->block_ || offset < v->offset_) {
     v->block_ = block;
     // use address if not SDHC card
@@ -218,13 +244,12 @@ uint8_t Sd2Card_readData(st_Sd2Card_v *v, uint32_t block,
   }
 
   // skip data before offset
-  for (;v->offset_ < offset; v->offset_++) {
-    Sd2Card_spiRec();
+  if (v->offset_ < offset) {
+    Sd2Card_spiRead(NULL, offset - v->offset_);
+    v->offset_ = offset;
   }
   // transfer data
-  for (i = 0; i < count; i++) {
-    dst[i] = Sd2Card_spiRec();
-  }
+  Sd2Card_spiRead(dst, count);
 
   v->offset_ += count;
   if (!v->partialBlockRead_ || v->offset_ >= 512) {
@@ -242,11 +267,113 @@ uint8_t Sd2Card_readData(st_Sd2Card_v *v, uint32_t block,
 void Sd2Card_readEnd(st_Sd2Card_v *v) {
   if (v->inBlock_) {
       // skip data and crc
-    while (v->offset_++ < 514) Sd2Card_spiRec();
+    if (v->offset_ < 514) Sd2Card_spiRead(NULL, 514 - v->offset_);
     Sd2Card_chipSelectHigh(v);
     v->inBlock_ = 0;
   }
 }
+//------------------------------------------------------------------------------
+/**
+ * Start a read multiple blocks sequence (CMD18).
+ *
+ * \param[in] blockNumber Address of first block in sequence.
+ *
+ * \note This function is used with readNext() and readStop() for
+ * optimized multiple block reads.  The sequence is also ended by
+ * any other command to the card.
+ *
+ * \return The value one, true, is returned for success and
+ * the value zero, false, is returned for failure.
+ */
+uint8_t Sd2Card_readStart(st_Sd2Card_v *v, uint32_t blockNumber) {
+  // single block read is used
+  if (!v->streamEnable_) return true;
+
+  // continue current sequence
+  if (v->stream_ == SD_STREAM_READ && v->streamBlock_ == blockNumber) return true;
+
+  // use address if not SDHC card
+  if (Sd2Card_cardCommand(v, CMD18,
+      v->type_ == SD_CARD_TYPE_SDHC ? blockNumber : blockNumber << 9)) {
+    Sd2Card_error(v, SD_CARD_ERROR_CMD18);
+    goto fail;
+  }
+  v->stream_ = SD_STREAM_READ;
+  v->streamBlock_ = blockNumber;
+  Sd2Card_chipSelectHigh(v);
+  return true;
+
+ fail:
+  Sd2Card_chipSelectHigh(v);
+  return false;
+}
+//------------------------------------------------------------------------------
+/**
+ * Read one data block in a multiple block read sequence.
+ *
+ * \param[out] dst Pointer to the location for the data to be read.
+ *
+ * \return The value one, true, is returned for success and
+ * the value zero, false, is returned for failure.
+ */
+uint8_t Sd2Card_readNext(st_Sd2Card_v *v, uint8_t* dst) {
+  if (v->stream_ != SD_STREAM_READ) return false;
+
+  Sd2Card_chipSelectLow(v);
+  if (!Sd2Card_waitStartBlock(v)) goto fail;
+
+  // transfer data and discard crc
+  Sd2Card_spiRead(dst, 512);
+  Sd2Card_spiRead(NULL, 2);
+
+  v->lastBlock_ = v->streamBlock_++;
+  Sd2Card_chipSelectHigh(v);
+  return true;
+
+ fail:
+  Sd2Card_readStop(v);
+  return false;
+}
+//------------------------------------------------------------------------------
+/**
+ * End a read multiple blocks sequence.
+ *
+ * \return The value one, true, is returned for success and
+ * the value zero, false, is returned for failure.
+ */
+uint8_t Sd2Card_readStop(st_Sd2Card_v *v) {
+  if (v->stream_ != SD_STREAM_READ) return true;
+  v->stream_ = SD_STREAM_NONE;
+
+  if (Sd2Card_cardCommand(v, CMD12, (uint32_t)0)) {
+    Sd2Card_error(v, SD_CARD_ERROR_CMD12);
+    goto fail;
+  }
+  // response is r1b. wait end of busy
+  Sd2Card_waitNotBusy(SD_READ_TIMEOUT);
+  Sd2Card_chipSelectHigh(v);
+  return true;
+
+ fail:
+  Sd2Card_chipSelectHigh(v);
+  return false;
+}
+//------------------------------------------------------------------------------
+/** End a read or write multiple blocks sequence if it is in progress. */
+uint8_t Sd2Card_streamStop(st_Sd2Card_v *v) {
+  if (v->stream_ == SD_STREAM_READ) return Sd2Card_readStop(v);
+  if (v->stream_ == SD_STREAM_WRITE) return Sd2Card_writeStop(v);
+  return true;
+}
+//------------------------------------------------------------------------------
+/**
+ * Enable or disable multiple block commands.  Enabled by init().
+ * Disable it for a card which does not support CMD18/CMD25 correctly.
+ */
+void Sd2Card_setStreaming(st_Sd2Card_v *v, uint8_t enable) {
+  Sd2Card_streamStop(v);
+  v->streamEnable_ = enable;
+}
 //------------------------------------------------------------------------------
   /** Return the card type: SD V1, SD V2 or SDHC */
 //  uint8_t Sd2Card_type(st_Sd2Card_v *v) {return v->type_;}
@@ -303,6 +430,15 @@ uint8_t Sd2Card_writeBlock(st_Sd2Card_v *v, uint32_t blockNumber, const uint8_t*
   }
 #endif  // SD_PROTECT_BLOCK_ZERO
 
+  // switch to multiple block write if blocks are written sequentially
+  if (blockNumber == v->lastBlock_ + 1) {
+    if (!Sd2Card_writeStart(v, blockNumber, (uint32_t)0)) goto fail;
+  }
+  if (v->stream_ == SD_STREAM_WRITE && blockNumber == v->streamBlock_) {
+    return Sd2Card_writeNext(v, src);
+  }
+  v->lastBlock_ = blockNumber;
+
   // use address if not SDHC card
   if (v->type_ != SD_CARD_TYPE_SDHC) blockNumber <<= 9;
   if (Sd2Card_cardCommand(v, CMD24, blockNumber)) {
@@ -331,15 +467,10 @@ uint8_t Sd2Card_writeBlock(st_Sd2Card_v *v, uint32_t blockNumber, const uint8_t*
 //------------------------------------------------------------------------------
 // send one block of data for write block or write multiple blocks
 uint8_t Sd2Card_writeData(st_Sd2Card_v *v, uint8_t token, const uint8_t* src) {
-  uint16_t i;
-
   Sd2Card_spiSend(token);
-  for (i = 0; i < 512; i++) {
-    Sd2Card_spiSend(src[i]);
-  }
+  SDCARD_SPI.transferBuffer(src, NULL, 512);
 
-  Sd2Card_spiSend(0xff);  // dummy crc
-  Sd2Card_spiSend(0xff);  // dummy crc
+  SDCARD_SPI.writeRepeat(0xFFFF, 1);  // dummy crc
 
   v->status_ = Sd2Card_spiRec();
   if ((v->status_ & DATA_RES_MASK) != DATA_RES_ACCEPTED) {
@@ -349,3 +480,109 @@ uint8_t Sd2Card_writeData(st_Sd2Card_v *v, uint8_t token, const uint8_t* src) {
   }
   return true;
 }
+//------------------------------------------------------------------------------
+/**
+ * Start a write multiple blocks sequence (CMD25).
+ *
+ * \param[in] blockNumber Address of first block in sequence.
+ *
+ * \param[in] eraseCount The number of blocks to be pre-erased (ACMD23).
+ * Zero skips pre-erase.  Data of pre-erased blocks which are not written
+ * is undefined, so this must be zero when existing data is overwritten.
+ *
+ * \note This function is used with writeNext() and writeStop() for
+ * optimized multiple block writes.  The sequence is also ended by
+ * any other command to the card.
+ *
+ * \return The value one, true, is returned for success and
+ * the value zero, false, is returned for failure.
+ */
+uint8_t Sd2Card_writeStart(st_Sd2Card_v *v, uint32_t blockNumber, uint32_t eraseCount) {
+  // single block write is used
+  if (!v->streamEnable_) return true;
+
+  // continue current sequence
+  if (v->stream_ == SD_STREAM_WRITE && v->streamBlock_ == blockNumber) return true;
+
+#if SD_PROTECT_BLOCK_ZERO
+  // don't allow write to first block
+  if (blockNumber == 0) {
+    Sd2Card_error(v, SD_CARD_ERROR_WRITE_BLOCK_ZERO);
+    goto fail;
+  }
+#endif  // SD_PROTECT_BLOCK_ZERO
+  // send pre-erase count
+  if (eraseCount && Sd2Card_cardAcmd(v, ACMD23, eraseCount)) {
+    Sd2Card_error(v, SD_CARD_ERROR_ACMD23);
+    goto fail;
+  }
+  // use address if not SDHC card
+  if (Sd2Card_cardCommand(v, CMD25,
+      v->type_ == SD_CARD_TYPE_SDHC ? blockNumber : blockNumber << 9)) {
+    Sd2Card_error(v, SD_CARD_ERROR_CMD25);
+    goto fail;
+  }
+  v->stream_ = SD_STREAM_WRITE;
+  v->streamBlock_ = blockNumber;
+  Sd2Card_chipSelectHigh(v);
+  return true;
+
+ fail:
+  Sd2Card_chipSelectHigh(v);
+  return false;
+}
+//------------------------------------------------------------------------------
+/**
+ * Write one data block in a multiple block write sequence.
+ * Programming of the previous block is overlapped with this transfer,
+ * so no status check (CMD13) is required per block.
+ *
+ * \param[in] src Pointer to the location of the data to be written.
+ *
+ * \return The value one, true, is returned for success and
+ * the value zero, false, is returned for failure.
+ */
+uint8_t Sd2Card_writeNext(st_Sd2Card_v *v, const uint8_t* src) {
+  if (v->stream_ != SD_STREAM_WRITE) return false;
+
+  Sd2Card_chipSelectLow(v);
+  // wait for previous write to finish
+  if (!Sd2Card_waitNotBusy(SD_WRITE_TIMEOUT)) {
+    Sd2Card_error(v, SD_CARD_ERROR_WRITE_MULTIPLE);
+    goto fail;
+  }
+  if (!Sd2Card_writeData(v, WRITE_MULTIPLE_TOKEN, src)) goto fail;
+
+  v->lastBlock_ = v->streamBlock_++;
+  Sd2Card_chipSelectHigh(v);
+  return true;
+
+ fail:
+  // card is recovered by the next command
+  v->stream_ = SD_STREAM_NONE;
+  Sd2Card_chipSelectHigh(v);
+  return false;
+}
+//------------------------------------------------------------------------------
+/**
+ * End a write multiple blocks sequence.
+ *
+ * \return The value one, true, is returned for success and
+ * the value zero, false, is returned for failure.
+ */
+uint8_t Sd2Card_writeStop(st_Sd2Card_v *v) {
+  if (v->stream_ != SD_STREAM_WRITE) return true;
+  v->stream_ = SD_STREAM_NONE;
+
+  Sd2Card_chipSelectLow(v);
+  if (!Sd2Card_waitNotBusy(SD_WRITE_TIMEOUT)) goto fail;
+  Sd2Card_spiSend(STOP_TRAN_TOKEN);
+  if (!Sd2Card_waitNotBusy(SD_WRITE_TIMEOUT)) goto fail;
+  Sd2Card_chipSelectHigh(v);
+  return true;
+
+ fail:
+  Sd2Card_error(v, SD_CARD_ERROR_STOP_TRAN);
+  Sd2Card_chipSelectHigh(v);
+  return false;
+}
@@ -22,6 +22,7 @@
 #define Sd2Card_h
 
 #include "SdInfo.h"
+#include "SPI.h"
 
 //------------------------------------------------------------------------------
 /** Protect block zero from write if nonzero */
@@ -80,6 +81,10 @@
 #define SD_CARD_ERROR_WRITE_TIMEOUT (0x15)
 /** incorrect rate selected */
 #define SD_CARD_ERROR_SCK_RATE (0x16)
+/** card returned an error response for CMD18 (read multiple blocks) */
+#define SD_CARD_ERROR_CMD18 (0x17)
+/** card returned an error response for CMD12 (stop transmission) */
+#define SD_CARD_ERROR_CMD12 (0x18)
 //------------------------------------------------------------------------------
 // SD card types
 /** Standard capacity V1 SD card */
@@ -89,6 +94,14 @@
 /** High Capacity SD card */
 #define SD_CARD_TYPE_SDHC (3)
 //------------------------------------------------------------------------------
+// streaming mode of multiple blocks
+/** single block command is used */
+#define SD_STREAM_NONE (0)
+/** in READ_MULTIPLE_BLOCK (CMD18) */
+#define SD_STREAM_READ (1)
+/** in WRITE_MULTIPLE_BLOCK (CMD25) */
+#define SD_STREAM_WRITE (2)
+//------------------------------------------------------------------------------
 
 typedef struct {
   uint32_t block_;
@@ -99,6 +112,11 @@ typedef struct {
   uint8_t  partialBlockRead_;
   uint8_t  status_;
   uint8_t  type_;
+  uint8_t  stream_;       // SD_STREAM_xxx
+  uint8_t  streamEnable_; // multiple block commands are used if nonzero
+  uint32_t streamBlock_;  // next block of streaming mode
+  uint32_t lastBlock_;    // last block transferred by whole block access
+  SPISettings spiSettings_;  // SPI settings applied while chip select is low
 } st_Sd2Card_v;
 
 uint8_t Sd2Card_cardAcmd(st_Sd2Card_v *v, uint8_t cmd, uint32_t arg);
@@ -110,10 +128,16 @@ boolean Sd2Card_init(st_Sd2Card_v *v, uint8_t sckRateID, uint8_t chipSelectPin);
 uint8_t Sd2Card_readBlock(st_Sd2Card_v *v, uint32_t block, uint8_t* dst);
 uint8_t Sd2Card_readData(st_Sd2Card_v *v, uint32_t block, uint16_t offset, uint16_t count, uint8_t* dst);
 void	Sd2Card_readEnd(st_Sd2Card_v *v);
+uint8_t Sd2Card_readStart(st_Sd2Card_v *v, uint32_t blockNumber);
+uint8_t Sd2Card_readNext(st_Sd2Card_v *v, uint8_t* dst);
+uint8_t Sd2Card_readStop(st_Sd2Card_v *v);
+uint8_t Sd2Card_streamStop(st_Sd2Card_v *v);
+void	Sd2Card_setStreaming(st_Sd2Card_v *v, uint8_t enable);
 uint8_t Sd2Card_waitNotBusy(uint16_t timeoutMillis);
 uint8_t Sd2Card_waitStartBlock(st_Sd2Card_v *v);
 uint8_t Sd2Card_writeBlock(st_Sd2Card_v *v, uint32_t blockNumber, const uint8_t* src);
 uint8_t Sd2Card_writeData(st_Sd2Card_v *v, uint8_t token, const uint8_t* src);
+uint8_t Sd2Card_writeNext(st_Sd2Card_v *v, const uint8_t* src);
 uint8_t Sd2Card_writeStart(st_Sd2Card_v *v, uint32_t blockNumber, uint32_t eraseCount);
 uint8_t Sd2Card_writeStop(st_Sd2Card_v *v);
 void	Sd2Card_type(st_Sd2Card_v *v, uint8_t value);
@@ -99,6 +99,20 @@
 // value for action argument in cacheRawBlock to indicate cache dirty
 #define CACHE_FOR_WRITE (1)
 
+// number of 512 byte block cache slots. 1 to 4
+// slot 0 is used only for FAT blocks if there are two or more slots.
+// default is 1 slot, same RAM as before. each additional slot uses 512 bytes of RAM.
+// define it by build option so that all files use the same value.
+//   ex) CMPOPT=/DSD_CACHE_SLOTS=2
+#ifndef SD_CACHE_SLOTS
+#define SD_CACHE_SLOTS (1)
+#endif
+#if (SD_CACHE_SLOTS < 1) || (SD_CACHE_SLOTS > 4)
+#error SD_CACHE_SLOTS must be 1 to 4
+#endif
+// slot for FAT blocks
+#define SD_CACHE_FAT_SLOT (0)
+
 __packed union cache_t {
            /** Used to access cached file data blocks. */
   uint8_t  data[512];
@@ -115,11 +129,21 @@ __packed union cache_t {
 };
 
 typedef __packed struct {
-  __packed union cache_t cacheBuffer_;        // 512 byte cache for device blocks
-  uint32_t  cacheBlockNumber_;  // Logical number of block in the cache
+  __packed union cache_t buffer;  // 512 byte cache for device blocks
+  uint32_t  blockNumber;          // Logical number of block in the slot
+  uint32_t  mirrorBlock;          // block number for mirror FAT
+  uint8_t   dirty;                // cacheFlush() will write block if true
+  uint8_t   age;                  // accesses to other slots since last access, for LRU
+} st_SdCache_v;
+
+typedef __packed struct {
+  st_SdCache_v cache_[SD_CACHE_SLOTS];  // block cache
+  __packed union cache_t *cacheBuffer_; // buffer of the slot last accessed
+  uint32_t  cacheBlockNumber_;  // Logical number of block in the slot last accessed
+  uint8_t   cacheSlot_;         // slot last accessed
+  uint32_t  cacheHit_;          // number of accesses found in cache
+  uint32_t  cacheMiss_;         // number of accesses read from card
   st_Sd2Card_v* sdCard_;            // Sd2Card object for cache
-  uint8_t   cacheDirty_;         // cacheFlush() will write block if true
-  uint32_t  cacheMirrorBlock_;  // block number for mirror FAT
   uint32_t  allocSearchStart_;   // start cluster for alloc search
   uint8_t   blocksPerCluster_;    // cluster size in blocks
   uint32_t  blocksPerFat_;       // FAT size in blocks
@@ -133,6 +157,18 @@ typedef __packed struct {
   uint32_t	rootDirStart_;       // root start block for FAT16, cluster for FAT32
 } st_SdVolume_v;
 
+// number of cluster runs remembered by each file. 0 to disable.
+// seek and read use the runs instead of following the FAT chain.
+// define it by build option so that all files use the same value.
+#ifndef SD_EXTENT_SLOTS
+#define SD_EXTENT_SLOTS (4)
+#endif
+
+typedef struct {
+  uint32_t  firstCluster;   // first cluster of the run
+  uint32_t  count;          // number of consecutive clusters in the run
+} st_SdExtent_v;
+
 typedef struct {
   int       write_error_;   // come from Print class
   uint8_t   flags_;         // See above for definition of flags_ bits
@@ -143,7 +179,13 @@ typedef struct {
   uint8_t   dirIndex_;      // index of entry in SdFile_dirBlock 0 <= dirIndex_ <= 0XF
   uint32_t  fileSize_;      // file size in bytes
   uint32_t  firstCluster_;  // first cluster of file
+  uint32_t  contiguousEnd_; // end of contiguous clusters in bytes. raw-append mode if nonzero
   st_SdVolume_v *vol_;           // volume where file is located
+#if SD_EXTENT_SLOTS > 0
+  st_SdExtent_v extent_[SD_EXTENT_SLOTS]; // cluster runs from start of file
+  uint8_t   extentCount_;   // number of runs in extent_
+  uint32_t  extentClusters_; // number of clusters of file in extent_
+#endif
 } st_SdFile_v;
 
 void     SdFile_setWriteError(st_SdFile_v *v);
@@ -154,6 +196,7 @@ uint8_t  SdFile_addDirCluster(st_SdFile_v *v);
 dir_t*   SdFile_cacheDirEntry(st_SdFile_v *v, uint8_t action);
 uint8_t  SdFile_make83Name(const char* str, uint8_t* name);
 uint8_t  SdFile_close(st_SdFile_v *v);
+uint8_t  SdFile_createContiguous(st_SdFile_v *v, st_SdFile_v* dirFile, const char* fileName, uint32_t size);
 uint32_t SdFile_curCluster(st_SdFile_v *v);
 uint32_t SdFile_curPosition(st_SdFile_v *v);
 void     SdFile_dateTime(uint16_t* date, uint16_t* time);
@@ -192,9 +235,14 @@ size_t   SdFile_write(st_SdFile_v *v, const uint8_t* buf, uint16_t nbyte);
 
 uint8_t  SdVolume_allocContiguous(st_SdVolume_v *v, uint32_t count, uint32_t *curCluster);
 uint8_t  SdVolume_blockOfCluster(st_SdVolume_v *v, uint32_t position);
+uint8_t  SdVolume_cacheFatBlock(st_SdVolume_v *v, uint32_t blockNumber, uint8_t action);
 uint8_t  SdVolume_cacheFlush(st_SdVolume_v *v);
+void     SdVolume_cacheInvalidate(st_SdVolume_v *v, uint32_t blockNumber);
+boolean  SdVolume_cacheIsCached(st_SdVolume_v *v, uint32_t blockNumber);
+uint8_t  SdVolume_cacheNewBlock(st_SdVolume_v *v, uint32_t blockNumber);
 uint8_t  SdVolume_cacheRawBlock(st_SdVolume_v *v, uint32_t blockNumber, uint8_t action);
 void     SdVolume_cacheSetDirty(st_SdVolume_v *v);
+void     SdVolume_cacheStats(st_SdVolume_v *v, uint32_t *hit, uint32_t *miss);
 uint8_t  SdVolume_cacheZeroBlock(st_SdVolume_v *v, uint32_t blockNumber);
 uint8_t  SdVolume_chainSize(st_SdVolume_v *v, uint32_t beginCluster, uint32_t* size);
 uint32_t SdVolume_clusterStartBlock(st_SdVolume_v *v, uint32_t cluster);
@@ -206,6 +254,9 @@ boolean  SdVolume_init(st_SdVolume_v *v, st_Sd2Card_v* dev);
 boolean  SdVolume_initPart(st_SdVolume_v *v, st_Sd2Card_v* dev, uint8_t part);
 boolean  SdVolume_isEOC(st_SdVolume_v *v, uint32_t cluster);
 uint8_t  SdVolume_readData(st_SdVolume_v *v, uint32_t block, uint16_t offset, uint16_t count, uint8_t* dst);
+uint8_t  SdVolume_readStart(st_SdVolume_v *v, uint32_t block);
+uint8_t  SdVolume_streamStop(st_SdVolume_v *v);
 uint8_t  SdVolume_writeBlock(st_SdVolume_v *v, uint32_t block, const uint8_t* dst);
+uint8_t  SdVolume_writeStart(st_SdVolume_v *v, uint32_t block, uint32_t eraseCount);
 
 #endif  // SdFat_h
@@ -35,6 +35,70 @@ void SdFile_clearWriteError(st_SdFile_v *v) {
 	v->write_error_ = 0;
 }
 //------------------------------------------------------------------------------
+// forget cluster runs of a file
+static void SdFile_extentClear(st_SdFile_v *v) {
+#if SD_EXTENT_SLOTS > 0
+  v->extentCount_ = 0;
+  v->extentClusters_ = 0;
+#endif
+}
+//------------------------------------------------------------------------------
+// remember cluster of a file. index is cluster number from start of file.
+// runs grow only from the end, so the cluster is ignored if it is not next
+// to the last run or if the table is full.
+static void SdFile_extentAdd(st_SdFile_v *v, uint32_t index, uint32_t cluster) {
+#if SD_EXTENT_SLOTS > 0
+  st_SdExtent_v *e;
+
+  if (index != v->extentClusters_ || cluster < 2) return;
+  e = &v->extent_[v->extentCount_ ? v->extentCount_ - 1 : 0];
+  if (v->extentCount_ && (e->firstCluster + e->count) == cluster) {
+    e->count++;
+  } else if (v->extentCount_ < SD_EXTENT_SLOTS) {
+    e = &v->extent_[v->extentCount_++];
+    e->firstCluster = cluster;
+    e->count = 1;
+  } else {
+    return;
+  }
+  v->extentClusters_++;
+#endif
+}
+//------------------------------------------------------------------------------
+// get cluster of a file from cluster runs
+// return false if index is not in the runs
+static uint8_t SdFile_extentGet(st_SdFile_v *v, uint32_t index, uint32_t *cluster) {
+#if SD_EXTENT_SLOTS > 0
+  uint8_t i;
+
+  if (index >= v->extentClusters_) return false;
+  for (i = 0; i < v->extentCount_; i++) {
+    if (index < v->extent_[i].count) {
+      *cluster = v->extent_[i].firstCluster + index;
+      return true;
+    }
+    index -= v->extent_[i].count;
+  }
+#endif
+  return false;
+}
+//------------------------------------------------------------------------------
+// get last cluster in the runs and its index
+// return false if there is no run
+static uint8_t SdFile_extentLast(st_SdFile_v *v, uint32_t *index, uint32_t *cluster) {
+#if SD_EXTENT_SLOTS > 0
+  st_SdExtent_v *e;
+
+  if (v->extentCount_ == 0) return false;
+  e = &v->extent_[v->extentCount_ - 1];
+  *index = v->extentClusters_ - 1;
+  *cluster = e->firstCluster + e->count - 1;
+  return true;
+#else
+  return false;
+#endif
+}
+//------------------------------------------------------------------------------
 // add a cluster to a file
 uint8_t SdFile_addCluster(st_SdFile_v *v) {
   if (!SdVolume_allocContiguous(v->vol_, (uint32_t)1, &v->curCluster_)) return false;
@@ -68,7 +132,7 @@ uint8_t SdFile_addDirCluster(st_SdFile_v *v) {
 // return pointer to cached entry or null for failure
 dir_t* SdFile_cacheDirEntry(st_SdFile_v *v, uint8_t action) {
   if (!SdVolume_cacheRawBlock(v->vol_, v->dirBlock_, action)) return NULL;
-  return v->vol_->cacheBuffer_.dir + v->dirIndex_;
+  return v->vol_->cacheBuffer_->dir + v->dirIndex_;
 }
 //------------------------------------------------------------------------------
 /**
@@ -80,11 +144,70 @@ dir_t* SdFile_cacheDirEntry(st_SdFile_v *v, uint8_t action) {
  * Reasons for failure include no file is open or an I/O error.
  */
 uint8_t SdFile_close(st_SdFile_v *v) {
+  // release clusters of contiguous file which are not written
+  if (SdFile_isOpen(v) && v->contiguousEnd_ && (v->flags_ & O_WRITE)) {
+    if (v->fileSize_ == 0) {
+      if (!SdVolume_freeChain(v->vol_, v->firstCluster_)) return false;
+      v->firstCluster_ = 0;
+      v->contiguousEnd_ = 0;
+      SdFile_extentClear(v);
+      v->flags_ |= F_FILE_DIR_DIRTY;
+    } else {
+      if (!SdFile_truncate(v, v->fileSize_)) return false;
+    }
+  }
   if (!SdFile_sync(v)) return false;
   v->type_ = FAT_FILE_TYPE_CLOSED;
   return true;
 }
 //------------------------------------------------------------------------------
+/**
+ * Create and open a new file with contiguous clusters in raw-append mode.
+ *
+ * \param[in] dirFile The directory where the file will be created.
+ * \param[in] fileName A valid DOS 8.3 file name.
+ * \param[in] size The number of bytes to be allocated for the file.
+ *
+ * \note The file size is zero at first and grows by write().  While
+ * the file position is in the allocated range, write() goes to the
+ * consecutive blocks without FAT access and only sync() updates the
+ * directory entry.  Data over \a size is written in normal mode.
+ * Clusters which are not written are released by close().
+ *
+ * \return The value one, true, is returned for success and
+ * the value zero, false, is returned for failure.
+ * Reasons for failure include \a fileName contains an invalid DOS 8.3
+ * file name, the FAT volume has not been initialized, a file is already
+ * open, the file already exists, the root directory is full or an I/O error.
+ */
+uint8_t SdFile_createContiguous(st_SdFile_v *v, st_SdFile_v* dirFile, const char* fileName, uint32_t size) {
+  uint32_t count;
+
+  // don't allow zero length file
+  if (size == 0) return false;
+  if (!SdFile_openName(v, dirFile, fileName, O_CREAT | O_EXCL | O_RDWR)) return false;
+
+  // calculate number of clusters needed
+  count = ((size - 1) >> (v->vol_->clusterSizeShift_ + 9)) + 1;
+
+  // allocate clusters
+  if (!SdVolume_allocContiguous(v->vol_, count, &v->firstCluster_)) {
+    SdFile_remove(v);
+    return false;
+  }
+  v->contiguousEnd_ = count << (v->vol_->clusterSizeShift_ + 9);
+#if SD_EXTENT_SLOTS > 0
+  v->extent_[0].firstCluster = v->firstCluster_;
+  v->extent_[0].count = count;
+  v->extentCount_ = 1;
+  v->extentClusters_ = count;
+#endif
+
+  // insure sync() will update dir entry
+  v->flags_ |= F_FILE_DIR_DIRTY;
+  return SdFile_sync(v);
+}
+//------------------------------------------------------------------------------
 /** \return The current position for a file or directory. */
 uint32_t SdFile_curPosition(st_SdFile_v *v) {return v->curPosition_;}
 //------------------------------------------------------------------------------
@@ -122,6 +245,8 @@ void SdFile_dirName(const dir_t* dir, char* name) {
 /* constructer for SdFile Class */
 void SdFile_init(st_SdFile_v *v) {
   v->type_ = FAT_FILE_TYPE_CLOSED;
+  v->contiguousEnd_ = 0;
+  SdFile_extentClear(v);
 }
 //------------------------------------------------------------------------------
 /** \return True if this is a SdFile for a directory else false. */
@@ -219,7 +344,7 @@ uint8_t SdFile_makeDir(st_SdFile_v *v, st_SdFile_v* dir, const char* dirName) {
   if (!SdVolume_cacheRawBlock(v->vol_, block, CACHE_FOR_WRITE)) return false;
 
   // copy '.' to block
-  memcpy(&v->vol_->cacheBuffer_.dir[0], &d, sizeof(d));
+  memcpy(&v->vol_->cacheBuffer_->dir[0], &d, sizeof(d));
 
   // make entry for '..'
   d.name[1] = '.';
@@ -231,7 +356,7 @@ uint8_t SdFile_makeDir(st_SdFile_v *v, st_SdFile_v* dir, const char* dirName) {
     d.firstClusterHigh = (uint16_t)(dir->firstCluster_ >> 16);
   }
   // copy '..' to block
-  memcpy(&v->vol_->cacheBuffer_.dir[1], &d, sizeof(d));
+  memcpy(&v->vol_->cacheBuffer_->dir[1], &d, sizeof(d));
 
   // set position after '..'
   v->curPosition_ = 2 * sizeof(d);
@@ -337,7 +462,7 @@ uint8_t SdFile_openName(st_SdFile_v *v, st_SdFile_v* dirFile, const char* fileNa
 
     // use first entry in cluster
     v->dirIndex_ = 0;
-    p = v->vol_->cacheBuffer_.dir;
+    p = v->vol_->cacheBuffer_->dir;
   }
   // initialize as empty file
   memset(p, 0, sizeof(dir_t));
@@ -400,7 +525,7 @@ uint8_t SdFile_openIndex(st_SdFile_v *v, st_SdFile_v *dirFile, uint16_t index, u
 // open a cached directory entry. Assumes v->vol_ is initializes
 uint8_t SdFile_openCachedEntry(st_SdFile_v *v, uint8_t dirIndex, uint8_t oflag) {
   // location of entry in cache
-  dir_t* p = v->vol_->cacheBuffer_.dir + dirIndex;  // W4028(1) warning is no problem after comfirmation.
+  dir_t* p = v->vol_->cacheBuffer_->dir + dirIndex;  // W4028(1) warning is no problem after comfirmation.
 
   // write or truncate is an error for a directory or read-only file
   if (p->attributes & (DIR_ATT_READ_ONLY | DIR_ATT_DIRECTORY)) {
@@ -430,6 +555,8 @@ uint8_t SdFile_openCachedEntry(st_SdFile_v *v, uint8_t dirIndex, uint8_t oflag)
   // set to start of file
   v->curCluster_ = 0;
   v->curPosition_ = 0;
+  v->contiguousEnd_ = 0;
+  SdFile_extentClear(v);
 
   // truncate file to zero length if requested
   if (oflag & O_TRUNC) return SdFile_truncate(v, (uint32_t)0);
@@ -469,6 +596,8 @@ boolean SdFile_openRoot(st_SdFile_v *v, st_SdVolume_v *vol) {
   // set to start of file
   v->curCluster_ = 0;
   v->curPosition_ = 0;
+  v->contiguousEnd_ = 0;
+  SdFile_extentClear(v);
 
   // root has no directory entry
   v->dirBlock_ = 0;
@@ -524,13 +653,17 @@ int16_t SdFile_read(st_SdFile_v *v, uint8_t* buf, uint16_t nbyte) {
       blockOfCluster = SdVolume_blockOfCluster(v->vol_, v->curPosition_);
       if (offset == 0 && blockOfCluster == 0) {
         // start of new cluster
-        if (v->curPosition_ == 0) {
+        if (v->curPosition_ < v->contiguousEnd_) {
+          // contiguous file - no FAT access
+          v->curCluster_ = v->firstCluster_ + (v->curPosition_ >> (v->vol_->clusterSizeShift_ + 9));
+        } else if (v->curPosition_ == 0) {
           // use first cluster in file
           v->curCluster_ = v->firstCluster_;
-        } else {
+        } else if (!SdFile_extentGet(v, v->curPosition_ >> (v->vol_->clusterSizeShift_ + 9), &v->curCluster_)) {
           // get next cluster from FAT
           if (!SdVolume_fatGet(v->vol_, v->curCluster_, &v->curCluster_)) return -1;
         }
+        SdFile_extentAdd(v, v->curPosition_ >> (v->vol_->clusterSizeShift_ + 9), v->curCluster_);
       }
       block = SdVolume_clusterStartBlock(v->vol_, v->curCluster_) + blockOfCluster;
     }
@@ -541,13 +674,17 @@ int16_t SdFile_read(st_SdFile_v *v, uint8_t* buf, uint16_t nbyte) {
 
     // no buffering needed if n == 512 or user requests no buffering
     if ((SdFile_unbufferedRead(v) || n == 512) &&
-      block != v->vol_->cacheBlockNumber_) {
+      !SdVolume_cacheIsCached(v->vol_, block)) {
+      // use multiple block read if more blocks follow
+      if (n == 512 && toRead >= 1024) {
+        if (!SdVolume_readStart(v->vol_, block)) return -1;
+      }
       if (!SdVolume_readData(v->vol_, block, offset, n, dst)) return -1;
       dst += n;
     } else {
       // read block to cache and copy data to caller
       if (!SdVolume_cacheRawBlock(v->vol_, block, CACHE_FOR_READ)) return -1;
-      src = v->vol_->cacheBuffer_.data + offset;
+      src = v->vol_->cacheBuffer_->data + offset;
       end = src + n;
       while (src != end) *dst++ = *src++;
     }
@@ -603,7 +740,7 @@ dir_t* SdFile_readDirCache(st_SdFile_v *v) {
   v->curPosition_ += 31;
 
   // return pointer to entry
-  return (v->vol_->cacheBuffer_.dir + i);
+  return (v->vol_->cacheBuffer_->dir + i);
 }
 //------------------------------------------------------------------------------
 /**
@@ -731,7 +868,7 @@ uint8_t SdFile_seekEnd(st_SdFile_v *v) {return SdFile_seekSet(v, v->fileSize_);}
  * the value zero, false, is returned for failure.
  */
 uint8_t SdFile_seekSet(st_SdFile_v *v, uint32_t pos) {
-  uint32_t nCur, nNew;
+  uint32_t nCur, nNew, nRun, cluster;
   // error if file not open or seek past end of file
   if (!SdFile_isOpen(v) || pos > v->fileSize_) return false;
 
@@ -749,15 +886,35 @@ uint8_t SdFile_seekSet(st_SdFile_v *v, uint32_t pos) {
   nCur = (v->curPosition_ - 1) >> (v->vol_->clusterSizeShift_ + 9);
   nNew = (pos - 1) >> (v->vol_->clusterSizeShift_ + 9);
 
-  if (nNew < nCur || v->curPosition_ == 0) {
+  if (pos <= v->contiguousEnd_) {
+    // contiguous file - no FAT access
+    v->curCluster_ = v->firstCluster_ + nNew;
+    v->curPosition_ = pos;
+    return true;
+  }
+
+  if (SdFile_extentGet(v, nNew, &cluster)) {
+    // cluster is in the runs - no FAT access
+    v->curCluster_ = cluster;
+    v->curPosition_ = pos;
+    return true;
+  }
+
+  if (SdFile_extentLast(v, &nRun, &cluster) &&
+      (nNew < nCur || v->curPosition_ == 0 || nCur < nRun)) {
+    // follow chain from end of the runs
+    nCur = nRun;
+    v->curCluster_ = cluster;
+  } else if (nNew < nCur || v->curPosition_ == 0) {
     // must follow chain from first cluster
+    nCur = 0;
     v->curCluster_ = v->firstCluster_;
-  } else {
-    // advance from curPosition
-    nNew -= nCur;
+    SdFile_extentAdd(v, nCur, v->curCluster_);
   }
-  while (nNew--) {
+  // else advance from curPosition
+  while (nCur < nNew) {
     if (!SdVolume_fatGet(v->vol_, v->curCluster_, &v->curCluster_)) return false;
+    SdFile_extentAdd(v, ++nCur, v->curCluster_);
   }
   v->curPosition_ = pos;
   return true;
@@ -794,6 +951,8 @@ uint8_t SdFile_sync(st_SdFile_v *v) {
     // clear directory dirty
     v->flags_ &= (uint8_t)(~F_FILE_DIR_DIRTY);
   }
+  // end multiple block write before directory is written
+  if (!SdVolume_streamStop(v->vol_)) return false;
   return SdVolume_cacheFlush(v->vol_);
 }
 
@@ -846,6 +1005,10 @@ uint8_t SdFile_truncate(st_SdFile_v *v, uint32_t length) {
   }
   v->fileSize_ = length;
 
+  // free clusters are not contiguous file any more
+  v->contiguousEnd_ = 0;
+  SdFile_extentClear(v);
+
   // need to update directory entry
   v->flags_ |= F_FILE_DIR_DIRTY;
 
@@ -881,7 +1044,7 @@ size_t SdFile_write(st_SdFile_v *v, const uint8_t* buf, uint16_t nbyte) {
   const uint8_t *src = buf;
   uint8_t blockOfCluster;
   uint16_t blockOffset, n;
-  uint32_t next, block;
+  uint32_t next, block, eraseCount;
   uint8_t *dst, *end;
 
   // number of bytes left to write  -  must be before goto statements
@@ -900,7 +1063,10 @@ size_t SdFile_write(st_SdFile_v *v, const uint8_t* buf, uint16_t nbyte) {
     blockOffset = (uint16_t)(v->curPosition_ & 0x1FF);
     if (blockOfCluster == 0 && blockOffset == 0) {
       // start of new cluster
-      if (v->curCluster_ == 0) {
+      if (v->curPosition_ < v->contiguousEnd_) {
+        // raw-append mode - next cluster is known without FAT access
+        v->curCluster_ = v->firstCluster_ + (v->curPosition_ >> (v->vol_->clusterSizeShift_ + 9));
+      } else if (v->curCluster_ == 0) {
         if (v->firstCluster_ == 0) {
           // allocate first cluster of file
           if (!SdFile_addCluster(v)) goto writeErrorReturn;
@@ -916,6 +1082,7 @@ size_t SdFile_write(st_SdFile_v *v, const uint8_t* buf, uint16_t nbyte) {
           v->curCluster_ = next;
         }
       }
+      SdFile_extentAdd(v, v->curPosition_ >> (v->vol_->clusterSizeShift_ + 9), v->curCluster_);
     }
     // max space in block
     n = 512 - blockOffset;
@@ -928,24 +1095,30 @@ size_t SdFile_write(st_SdFile_v *v, const uint8_t* buf, uint16_t nbyte) {
     if (n == 512) {
       // full block - don't need to use cache
       // invalidate cache if block is in cache
-      if (v->vol_->cacheBlockNumber_ == block) {
-        v->vol_->cacheBlockNumber_ = 0xFFFFFFFF;
+      SdVolume_cacheInvalidate(v->vol_, block);
+      if (v->curPosition_ >= v->fileSize_) {
+        // appending - use multiple block write and pre-erase rest of cluster
+        // or rest of contiguous clusters
+        eraseCount = (uint32_t)(v->vol_->blocksPerCluster_ - blockOfCluster);
+        if (v->curPosition_ < v->contiguousEnd_) {
+          eraseCount = (v->contiguousEnd_ - v->curPosition_) >> 9;
+          if (eraseCount > 0x7FFFFF) eraseCount = 0x7FFFFF;  // max count of ACMD23
+        }
+        if (!SdVolume_writeStart(v->vol_, block, eraseCount)) goto writeErrorReturn;
       }
       if (!SdVolume_writeBlock(v->vol_, block, src)) goto writeErrorReturn;
       src += 512;
     } else {
       if (blockOffset == 0 && v->curPosition_ >= v->fileSize_) {
         // start of new block don't need to read into cache
-        if (!SdVolume_cacheFlush(v->vol_)) goto writeErrorReturn;
-        v->vol_->cacheBlockNumber_ = block;
-        SdVolume_cacheSetDirty(v->vol_);
+        if (!SdVolume_cacheNewBlock(v->vol_, block)) goto writeErrorReturn;
       } else {
         // rewrite part of block
         if (!SdVolume_cacheRawBlock(v->vol_, block, CACHE_FOR_WRITE)) {
           goto writeErrorReturn;
         }
       }
-      dst = v->vol_->cacheBuffer_.data + blockOffset;
+      dst = v->vol_->cacheBuffer_->data + blockOffset;
       end = dst + n;
       while (dst != end) *dst++ = *src++;
     }
@@ -43,10 +43,14 @@
 #define  CMD9 (0x09)
 /** SEND_CID - read the card identification information (CID register) */
 #define  CMD10 (0x0A)
+/** STOP_TRANSMISSION - end multiple block read sequence */
+#define  CMD12 (0x0C)
 /** SEND_STATUS - read the card status register */
 #define  CMD13 (0x0D)
 /** READ_BLOCK - read a single data block from the card */
 #define  CMD17 (0x11)
+/** READ_MULTIPLE_BLOCK - read blocks of data until a STOP_TRANSMISSION */
+#define  CMD18 (0x12)
 /** WRITE_BLOCK - write a single data block to the card */
 #define  CMD24 (0x18)
 /** WRITE_MULTIPLE_BLOCK - write blocks of data until a STOP_TRANSMISSION */
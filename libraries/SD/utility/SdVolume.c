@@ -93,47 +93,139 @@ uint8_t SdVolume_blockOfCluster(st_SdVolume_v *v, uint32_t position) {
   return (uint8_t)((position >> 9) & (v->blocksPerCluster_ - 1));
 }
 //------------------------------------------------------------------------------
-uint8_t SdVolume_cacheFlush(st_SdVolume_v *v) {
-  if (v->cacheDirty_) {
-    if (!SdVolume_writeBlock(v, v->cacheBlockNumber_, v->cacheBuffer_.data)) {
+// make the slot accessible by cacheBuffer_ and update LRU
+static void SdVolume_cacheUse(st_SdVolume_v *v, uint8_t slot) {
+  uint8_t i;
+  for (i = 0; i < SD_CACHE_SLOTS; i++) {
+    if (v->cache_[i].age != 0xFF) v->cache_[i].age++;
+  }
+  v->cache_[slot].age = 0;
+  v->cacheSlot_ = slot;
+  v->cacheBuffer_ = &v->cache_[slot].buffer;
+  v->cacheBlockNumber_ = v->cache_[slot].blockNumber;
+}
+//------------------------------------------------------------------------------
+// return slot which has the block, or SD_CACHE_SLOTS if not cached
+static uint8_t SdVolume_cacheFind(st_SdVolume_v *v, uint32_t blockNumber) {
+  uint8_t i;
+  for (i = 0; i < SD_CACHE_SLOTS; i++) {
+    if (v->cache_[i].blockNumber == blockNumber) break;
+  }
+  return i;
+}
+//------------------------------------------------------------------------------
+// write back a dirty slot
+static uint8_t SdVolume_cacheFlushSlot(st_SdVolume_v *v, uint8_t slot) {
+  st_SdCache_v *c = &v->cache_[slot];
+  if (c->dirty) {
+    if (!SdVolume_writeBlock(v, c->blockNumber, c->buffer.data)) {
       return false;
     }
     // mirror FAT tables
-    if (v->cacheMirrorBlock_) {
-      if (!SdVolume_writeBlock(v, v->cacheMirrorBlock_, v->cacheBuffer_.data)) {
+    if (c->mirrorBlock) {
+      if (!SdVolume_writeBlock(v, c->mirrorBlock, c->buffer.data)) {
         return false;
       }
-      v->cacheMirrorBlock_ = 0;
+      c->mirrorBlock = 0;
     }
-    v->cacheDirty_ = 0;
+    c->dirty = 0;
   }
   return true;
 }
 //------------------------------------------------------------------------------
-uint8_t SdVolume_cacheRawBlock(st_SdVolume_v *v, uint32_t blockNumber, uint8_t action) {
-  if (v->cacheBlockNumber_ != blockNumber) {
-    if (!SdVolume_cacheFlush(v)) return false;
-    if (!Sd2Card_readBlock(v->sdCard_, blockNumber, v->cacheBuffer_.data)) return false;
-    v->cacheBlockNumber_ = blockNumber;
+// select and write back a slot to be replaced
+// FAT blocks use FAT slot, and other blocks use least recently used slot
+static uint8_t SdVolume_cacheVictim(st_SdVolume_v *v, uint8_t forFat, uint8_t *slot) {
+  uint8_t i, s = SD_CACHE_FAT_SLOT;
+  if (!forFat) {
+    for (i = SD_CACHE_FAT_SLOT + 1; i < SD_CACHE_SLOTS; i++) {
+      if (s == SD_CACHE_FAT_SLOT || v->cache_[i].age > v->cache_[s].age) s = i;
+    }
+  }
+  if (!SdVolume_cacheFlushSlot(v, s)) return false;
+  *slot = s;
+  return true;
+}
+//------------------------------------------------------------------------------
+// cache a block. block is not read if read is false
+static uint8_t SdVolume_cacheLoad(st_SdVolume_v *v, uint32_t blockNumber,
+    uint8_t action, uint8_t forFat, uint8_t read) {
+  uint8_t slot = SdVolume_cacheFind(v, blockNumber);
+
+  if (slot < SD_CACHE_SLOTS) {
+    v->cacheHit_++;
+  } else {
+    if (!SdVolume_cacheVictim(v, forFat, &slot)) return false;
+    v->cache_[slot].blockNumber = 0xFFFFFFFF;
+    if (read) {
+      v->cacheMiss_++;
+      if (!Sd2Card_readBlock(v->sdCard_, blockNumber, v->cache_[slot].buffer.data)) {
+        return false;
+      }
+    }
+    v->cache_[slot].blockNumber = blockNumber;
+  }
+  v->cache_[slot].dirty |= action;
+  SdVolume_cacheUse(v, slot);
+  return true;
+}
+//------------------------------------------------------------------------------
+// cache a FAT block. FAT block does not evict data or directory blocks
+uint8_t SdVolume_cacheFatBlock(st_SdVolume_v *v, uint32_t blockNumber, uint8_t action) {
+  return SdVolume_cacheLoad(v, blockNumber, action, true, true);
+}
+//------------------------------------------------------------------------------
+// write back all dirty slots
+uint8_t SdVolume_cacheFlush(st_SdVolume_v *v) {
+  uint8_t i;
+  for (i = 0; i < SD_CACHE_SLOTS; i++) {
+    if (!SdVolume_cacheFlushSlot(v, i)) return false;
   }
-  v->cacheDirty_ |= action;
   return true;
 }
 //------------------------------------------------------------------------------
-void SdVolume_cacheSetDirty(st_SdVolume_v *v) {v->cacheDirty_ |= CACHE_FOR_WRITE;}
+// discard a cached block which will be overwritten by direct write
+void SdVolume_cacheInvalidate(st_SdVolume_v *v, uint32_t blockNumber) {
+  uint8_t slot = SdVolume_cacheFind(v, blockNumber);
+  if (slot < SD_CACHE_SLOTS) {
+    v->cache_[slot].blockNumber = 0xFFFFFFFF;
+    v->cache_[slot].dirty = 0;
+    v->cache_[slot].mirrorBlock = 0;
+    if (slot == v->cacheSlot_) v->cacheBlockNumber_ = 0xFFFFFFFF;
+  }
+}
+//------------------------------------------------------------------------------
+boolean SdVolume_cacheIsCached(st_SdVolume_v *v, uint32_t blockNumber) {
+  return (boolean)(SdVolume_cacheFind(v, blockNumber) < SD_CACHE_SLOTS);
+}
+//------------------------------------------------------------------------------
+// cache a block for write without reading it from card
+uint8_t SdVolume_cacheNewBlock(st_SdVolume_v *v, uint32_t blockNumber) {
+  return SdVolume_cacheLoad(v, blockNumber, CACHE_FOR_WRITE, false, false);
+}
+//------------------------------------------------------------------------------
+uint8_t SdVolume_cacheRawBlock(st_SdVolume_v *v, uint32_t blockNumber, uint8_t action) {
+  return SdVolume_cacheLoad(v, blockNumber, action, false, true);
+}
+//------------------------------------------------------------------------------
+void SdVolume_cacheSetDirty(st_SdVolume_v *v) {v->cache_[v->cacheSlot_].dirty |= CACHE_FOR_WRITE;}
+//------------------------------------------------------------------------------
+// get number of cache hits and block reads by cache misses
+void SdVolume_cacheStats(st_SdVolume_v *v, uint32_t *hit, uint32_t *miss) {
+  *hit = v->cacheHit_;
+  *miss = v->cacheMiss_;
+}
 //------------------------------------------------------------------------------
 // cache a zero block for blockNumber
 uint8_t SdVolume_cacheZeroBlock(st_SdVolume_v *v, uint32_t blockNumber) {
   uint16_t i;
 
-  if (!SdVolume_cacheFlush(v)) return false;
+  if (!SdVolume_cacheNewBlock(v, blockNumber)) return false;
 
-  // loop take less flash than memset(cacheBuffer_.data, 0, 512);
+  // loop take less flash than memset(cacheBuffer_->data, 0, 512);
   for (i = 0; i < 512; i++) {
-    v->cacheBuffer_.data[i] = 0;
+    v->cacheBuffer_->data[i] = 0;
   }
-  v->cacheBlockNumber_ = blockNumber;
-  SdVolume_cacheSetDirty(v);
   return true;
 }
 //------------------------------------------------------------------------------
@@ -159,13 +251,11 @@ uint8_t SdVolume_fatGet(st_SdVolume_v *v, uint32_t cluster, uint32_t* value) {
   if (cluster > (v->clusterCount_ + 1)) return false;
   lba = v->fatStartBlock_;
   lba += v->fatType_ == 16 ? cluster >> 8 : cluster >> 7;
-  if (lba != v->cacheBlockNumber_) {
-    if (!SdVolume_cacheRawBlock(v, lba, CACHE_FOR_READ)) return false;
-  }
+  if (!SdVolume_cacheFatBlock(v, lba, CACHE_FOR_READ)) return false;
   if (v->fatType_ == 16) {
-    *value = v->cacheBuffer_.fat16[cluster & 0XFF];
+    *value = v->cacheBuffer_->fat16[cluster & 0XFF];
   } else {
-    *value = v->cacheBuffer_.fat32[cluster & 0X7F] & FAT32MASK;
+    *value = v->cacheBuffer_->fat32[cluster & 0X7F] & FAT32MASK;
   }
   return true;
 }
@@ -184,19 +274,17 @@ uint8_t SdVolume_fatPut(st_SdVolume_v *v, uint32_t cluster, uint32_t value) {
   lba = v->fatStartBlock_;
   lba += v->fatType_ == 16 ? cluster >> 8 : cluster >> 7;
 
-  if (lba != v->cacheBlockNumber_) {
-    if (!SdVolume_cacheRawBlock(v, lba, CACHE_FOR_READ)) return false;
-  }
+  if (!SdVolume_cacheFatBlock(v, lba, CACHE_FOR_WRITE)) return false;
+
   // store entry
   if (v->fatType_ == (uint8_t)16) {
-    v->cacheBuffer_.fat16[cluster & 0XFF] = (uint16_t)value;
+    v->cacheBuffer_->fat16[cluster & 0XFF] = (uint16_t)value;
   } else {
-    v->cacheBuffer_.fat32[cluster & 0X7F] = value;
+    v->cacheBuffer_->fat32[cluster & 0X7F] = value;
   }
-  SdVolume_cacheSetDirty(v);
 
   // mirror second FAT
-  if (v->fatCount_ > 1) v->cacheMirrorBlock_ = lba + v->blocksPerFat_;
+  if (v->fatCount_ > 1) v->cache_[v->cacheSlot_].mirrorBlock = lba + v->blocksPerFat_;
   return true;
 }
 //----------------------------------------------------------------------------
@@ -234,11 +322,19 @@ uint8_t SdVolume_freeChain(st_SdVolume_v *v, uint32_t cluster) {
  * FAT file system or an I/O error.
  */
 boolean SdVolume_init(st_SdVolume_v *v, st_Sd2Card_v* dev) {
+  uint8_t i;
+
   // raw block cache
-  // init cacheBlockNumber_to invalid SD block number
-  v->cacheBlockNumber_ = 0xFFFFFFFF;
-  v->cacheDirty_ = 0;  // cacheFlush() will write block if true
-  v->cacheMirrorBlock_ = 0;  // mirror  block for second FAT
+  // init blockNumber to invalid SD block number
+  for (i = 0; i < SD_CACHE_SLOTS; i++) {
+    v->cache_[i].blockNumber = 0xFFFFFFFF;
+    v->cache_[i].dirty = 0;  // cacheFlush() will write block if true
+    v->cache_[i].mirrorBlock = 0;  // mirror  block for second FAT
+    v->cache_[i].age = 0;
+  }
+  SdVolume_cacheUse(v, SD_CACHE_FAT_SLOT);
+  v->cacheHit_ = 0;
+  v->cacheMiss_ = 0;
   v->allocSearchStart_ = 2;
   v->fatType_ = 0;
   return (boolean)(SdVolume_initPart(v, dev, 1) ? true : SdVolume_initPart(v, dev, 0));
@@ -271,7 +367,7 @@ boolean SdVolume_initPart(st_SdVolume_v *v, st_Sd2Card_v* dev, uint8_t part) {
   if (part) {
     if (part > 4)return false;
     if (!SdVolume_cacheRawBlock(v, volumeStartBlock, CACHE_FOR_READ)) return false;
-    p = &v->cacheBuffer_.mbr.part[part-1];    // W4028(1) warning is no problem after comfirmation.
+    p = &v->cacheBuffer_->mbr.part[part-1];    // W4028(1) warning is no problem after comfirmation.
     if ((p->boot & 0X7F) !=0  ||
       p->totalSectors < 100 ||
       p->firstSector == 0) {
@@ -281,7 +377,7 @@ boolean SdVolume_initPart(st_SdVolume_v *v, st_Sd2Card_v* dev, uint8_t part) {
     volumeStartBlock = p->firstSector;
   }
   if (!SdVolume_cacheRawBlock(v, volumeStartBlock, CACHE_FOR_READ)) return false;
-  bpb = &v->cacheBuffer_.fbs.bpb;
+  bpb = &v->cacheBuffer_->fbs.bpb;
   if (bpb->bytesPerSector != 512 ||
     bpb->fatCount == 0 ||
     bpb->reservedSectorCount == 0 ||
@@ -345,3 +441,18 @@ uint8_t SdVolume_readData(st_SdVolume_v *v, uint32_t block, uint16_t offset,
 uint8_t SdVolume_writeBlock(st_SdVolume_v *v, uint32_t block, const uint8_t* dst) {
     return Sd2Card_writeBlock(v->sdCard_, block, dst);
 }
+//------------------------------------------------------------------------------
+// start multiple block read. following readData() of whole blocks use it
+uint8_t SdVolume_readStart(st_SdVolume_v *v, uint32_t block) {
+    return Sd2Card_readStart(v->sdCard_, block);
+}
+//------------------------------------------------------------------------------
+// start multiple block write. following writeBlock() use it
+uint8_t SdVolume_writeStart(st_SdVolume_v *v, uint32_t block, uint32_t eraseCount) {
+    return Sd2Card_writeStart(v->sdCard_, block, eraseCount);
+}
+//------------------------------------------------------------------------------
+// end multiple block read or write
+uint8_t SdVolume_streamStop(st_SdVolume_v *v) {
+    return Sd2Card_streamStop(v->sdCard_);
+}
@@ -25,6 +25,7 @@
 #include "digitalio.h"
 #include "pin_assignment.h"
 #include "lp_manage.h"
+#include "driver_irq.h"
 
 //********************************************************************************
 //   global parameters
@@ -37,6 +38,13 @@ static void _spi_end(void);
 static void _spi_setBitOrder(uint8_t);
 static void _spi_setDataMode(uint8_t);
 static void _spi_setClockDivider(UINT16 ckdiv);
+static void _spi_transferBuffer(const uint8_t *tx, uint8_t *rx, uint16_t len);
+static void _spi_writeRepeat(uint16_t pattern, uint32_t count);
+static void _spi_readInto(uint8_t *buf, uint16_t len);
+static void _spi_beginTransaction(const SPISettings *settings);
+static void _spi_endTransaction(void);
+static BOOLEAN _spi_submit(SPI_XFER *xfer);
+static uint8_t _spi_poll(void);
 
 
 // SPI can be used from Arduino connector
@@ -50,26 +58,269 @@ const SPIClass SPI =
 	_spi_setBitOrder,
 	_spi_setDataMode,
 	_spi_setClockDivider,
+	_spi_transferBuffer,
+	_spi_writeRepeat,
+	_spi_readInto,
+	_spi_beginTransaction,
+	_spi_endTransaction,
+	_spi_submit,
+	_spi_poll,
 };
 
 //********************************************************************************
 //   local definitions
 //********************************************************************************
+#define SPI_FIFO_DEPTH		4		// number of SIOF0 FIFO stages
+
 //********************************************************************************
 //   local parameters
 //********************************************************************************
 static UINT16 _spi_brr = SPI_CLOCK_DIV4;
 static UCHAR  _spi_ctrl= ( SPI_MODE0 | SPI_MSBFIRST );
+static UINT16 _spi_hw_brr;				// settings applied to SIOF0
+static UCHAR  _spi_hw_ctrl;
+static bool   _spi_frame16 = false;	// true: 16bit frame is selected
+static bool   _spi_enabled = false;	// begin() is called
+static bool   _spi_use_irq = true;		// queue is processed in SIOF0 interrupt
+static bool   _spi_owned = false;		// bus is held by beginTransaction()
+
+// bytes transferred by FIFO
+static struct {
+	const uint8_t *tx;					// NULL = send 0xFF
+	uint8_t *rx;						// NULL = discard
+	UINT16 remain;						// bytes not loaded to FIFO
+	uint8_t frames;						// frames in FIFO
+} _spi_job;
+
+// queue of asynchronous transfers
+static SPI_XFER *_spi_xfer_head = NULL;
+static SPI_XFER *_spi_xfer_tail = NULL;
+static volatile UCHAR _spi_xfer_count = 0;
+static volatile bool _spi_xfer_active = false;	// head of queue is on bus
+static bool _spi_xfer_callback = false;	// in callback of completion
 
 //********************************************************************************
 //   local function definitions
 //********************************************************************************
+static void _spi_apply(UCHAR ctrl, UINT16 brr);
+static void _spi_set_frame16(bool on);
+static void _spi_fifo_run(UINT16 *frame, uint8_t n);
+static void _spi_job_load(void);
+static void _spi_job_unload(void);
+static void _spi_wait_async(void);
+static void _spi_xfer_start(void);
+static void _spi_xfer_done(void);
+static void _spi_isr(void);
+
 //********************************************************************************
 //   local functions
 //********************************************************************************
+// apply control and clock divider together. SPI is stopped while changing them.
+static void _spi_apply(UCHAR ctrl, UINT16 brr)
+{
+	if((_spi_hw_ctrl == ctrl) && (_spi_hw_brr == brr)) return;
+	write_reg8(SF0CTRLL, ctrl);			// SF0SPE is cleared
+	write_reg16(SF0BRR, brr);
+	set_bit(SF0MST);					// master mode
+	if(_spi_frame16) set_bit(SF0SIZE);
+	else clear_bit(SF0SIZE);
+	set_bit(SF0SPE);
+	_spi_hw_ctrl = ctrl;
+	_spi_hw_brr = brr;
+}
+
+// select 8bit or 16bit frame. SPI is stopped while changing frame size.
+static void _spi_set_frame16(bool on)
+{
+	if(_spi_frame16 == on) return;
+	clear_bit(SF0SPE);
+	if(on) set_bit(SF0SIZE);
+	else clear_bit(SF0SIZE);
+	set_bit(SF0SPE);
+	_spi_frame16 = on;
+}
+
+// send n frames (n <= SPI_FIFO_DEPTH) through FIFO and return rx frames in same buffer.
+// SF0SPIF is set when tx FIFO is empty and the last frame is transferred.
+static void _spi_fifo_run(UINT16 *frame, uint8_t n)
+{
+	uint8_t i;
+	set_bit(SF0SPIFC);
+	for(i = 0; i < n; i++)
+	{
+		write_reg16(SF0DWR, frame[i]);
+	}
+	while(get_bit(SF0SPIF)==0)
+	{
+		continue;
+	}
+	set_bit(SF0SPIFC);
+	for(i = 0; i < n; i++)
+	{
+		frame[i] = read_reg16(SF0DRR);
+	}
+}
+
+// load next frames of _spi_job to FIFO. 2 bytes are packed in a 16bit frame.
+// end of transfer is notified by SF0SPIF.
+static void _spi_job_load(void)
+{
+	const uint8_t *tx = _spi_job.tx;
+	UINT16 frame;
+	uint8_t i, n;
+
+	if(_spi_job.remain >= 2)
+	{
+		_spi_set_frame16(true);
+		n = (_spi_job.remain/2 > SPI_FIFO_DEPTH) ? SPI_FIFO_DEPTH : (uint8_t)(_spi_job.remain/2);
+		set_bit(SF0SPIFC);
+		for(i = 0; i < n; i++)
+		{
+			if(tx == NULL) frame = 0xFFFF;
+			else if(_spi_hw_ctrl & SPI_MSBFIRST) frame = (UINT16)(((UINT16)tx[0] << 8) | tx[1]);
+			else frame = (UINT16)(((UINT16)tx[1] << 8) | tx[0]);
+			write_reg16(SF0DWR, frame);
+			if(tx != NULL) tx += 2;
+		}
+		_spi_job.remain -= 2*n;
+	}
+	else
+	{
+		// odd byte
+		_spi_set_frame16(false);
+		n = 1;
+		set_bit(SF0SPIFC);
+		write_reg8(SF0DWRL, (tx != NULL) ? *tx++ : 0xFF);
+		_spi_job.remain--;
+	}
+	_spi_job.tx = tx;
+	_spi_job.frames = n;
+}
+
+// read frames of _spi_job from FIFO after SF0SPIF
+static void _spi_job_unload(void)
+{
+	uint8_t *rx = _spi_job.rx;
+	UINT16 frame;
+	uint8_t i;
+
+	set_bit(SF0SPIFC);
+	for(i = 0; i < _spi_job.frames; i++)
+	{
+		if(!_spi_frame16)
+		{
+			frame = SF0DRRL;
+			if(rx != NULL) *rx++ = (uint8_t)frame;
+			continue;
+		}
+		frame = read_reg16(SF0DRR);
+		if(rx == NULL) continue;
+		if(_spi_hw_ctrl & SPI_MSBFIRST) { rx[0] = (uint8_t)(frame >> 8); rx[1] = (uint8_t)frame; }
+		else                            { rx[0] = (uint8_t)frame; rx[1] = (uint8_t)(frame >> 8); }
+		rx += 2;
+	}
+	_spi_job.rx = rx;
+	_spi_job.frames = 0;
+}
+
+// wait until asynchronous transfers are completed
+// synchronous transfer must not be mixed with asynchronous transfers
+// transfers queued while bus is held are not waited
+// active is checked with SPI interrupt disabled, so that completion is not lost before HALT
+static void _spi_wait_async(void)
+{
+	bool active;
+
+	do {
+		if((getMIE() == 0) || !_spi_use_irq) {
+			active = _spi_xfer_active;
+			if(active) _spi_poll();
+		} else {
+			dis_interrupts(DI_SPI);
+			active = _spi_xfer_active;
+			if(active) lp_idle();
+			enb_interrupts(DI_SPI);
+		}
+	} while(active);
+}
+
+// start transfer of head of queue
+static void _spi_xfer_start(void)
+{
+	SPI_XFER *xfer = _spi_xfer_head;
+
+	if(!_spi_xfer_active) lp_addConstraint(LP_NEED_HSCLK);	// SPI stops in HALT-H mode
+	_spi_xfer_active = true;
+	if(xfer->settings != NULL)
+	{
+		_spi_apply(xfer->settings->ctrl, xfer->settings->brr);
+	}
+	if(xfer->cs != SPI_CS_NONE) digitalWrite(xfer->cs, LOW);
+
+	_spi_job.tx = xfer->tx_buf;
+	_spi_job.rx = xfer->rx_buf;
+	_spi_job.remain = xfer->len;
+	QSIOF0 = 0;
+	_spi_job_load();
+	if(_spi_use_irq) ESIOF0 = 1;
+}
+
+// complete transfer of head of queue and start next one
+static void _spi_xfer_done(void)
+{
+	SPI_XFER *xfer = _spi_xfer_head;
+
+	ESIOF0 = 0;
+	if(xfer->cs != SPI_CS_NONE) digitalWrite(xfer->cs, HIGH);
+
+	_spi_xfer_head = xfer->next;
+	if(_spi_xfer_head == NULL) _spi_xfer_tail = NULL;
+	_spi_xfer_count--;
+	_spi_xfer_active = false;
+	lp_removeConstraint(LP_NEED_HSCLK);
+	xfer->result = SPI_RESULT_OK;
+
+	if(xfer->callback)
+	{
+		_spi_xfer_callback = true;
+		xfer->callback(xfer);
+		_spi_xfer_callback = false;
+	}
+
+	// callback may start next transfer by submit
+	if(_spi_xfer_active) return;
+	if((_spi_xfer_head != NULL) && !_spi_owned)
+	{
+		_spi_xfer_start();
+	}
+	else
+	{
+		// settings of begin() for synchronous transfer
+		_spi_apply(_spi_ctrl, _spi_brr);
+	}
+}
+
+// SIOF0 interrupt. FIFO is reloaded until end of transfer.
+static void _spi_isr(void)
+{
+	if(!_spi_xfer_active || (get_bit(SF0SPIF) == 0)) return;
+
+	_spi_job_unload();
+	if(_spi_job.remain != 0)
+	{
+		_spi_job_load();
+	}
+	else
+	{
+		_spi_xfer_done();
+	}
+}
+
 static volatile unsigned char _spi_transfer(UCHAR _data)
 {
 	UCHAR res;
+	if(_spi_xfer_active) _spi_wait_async();
+	_spi_set_frame16(false);
 	set_bit(SF0SPIFC);
 	// set data
 	write_reg8(SF0DWRL,_data);
@@ -85,13 +336,23 @@ static volatile unsigned char _spi_transfer(UCHAR _data)
 	res = SF0DRRL;
 	return res;
 }
+
+// queue is processed in SIOF0 interrupt (default)
 static void _spi_attachInterrupt()
 {
-	
+	dis_interrupts(DI_SPI);
+	_spi_use_irq = true;
+	if(_spi_xfer_active) ESIOF0 = 1;
+	enb_interrupts(DI_SPI);
 }
+
+// queue is processed only in poll()
 static void _spi_detachInterrupt(void)
 {
-	
+	dis_interrupts(DI_SPI);
+	_spi_use_irq = false;
+	ESIOF0 = 0;
+	enb_interrupts(DI_SPI);
 }
 
 
@@ -101,8 +362,13 @@ static void _spi_begin(void)
 	clear_bit(DSIOF0);			// BLKCON  SPI enable
 	write_reg8(SF0CTRLL, _spi_ctrl);	// SIOF0 control
 	write_reg16(SF0BRR, _spi_brr);
+	_spi_hw_ctrl = _spi_ctrl;
+	_spi_hw_brr = _spi_brr;
 	// set SPI mode
 	set_bit(SF0MST);			// master mode
+	// 8bit frame
+	clear_bit(SF0SIZE);
+	_spi_frame16 = false;
 	// clear FIFO
 	set_bit(SF0FICL);
 	clear_bit(SF0FICL);
@@ -113,12 +379,42 @@ static void _spi_begin(void)
 	// SS setting
 //	pinMode(SS,OUTPUT);
 //	digitalWrite(SS,HIGH);
+	// interrupt of transfer end is used by asynchronous transfer
+	ESIOF0 = 0;
+	irq_sethandler(IRQ_NO_SIOF0INT,_spi_isr);
+	set_bit(SF0SPIE);
+	_spi_enabled = true;
 	// tx rx start
 	set_bit(SF0SPE);			// start SPI tx rx
 }
 static void _spi_end()
 {
+	SPI_XFER *xfer;
+	SPI_XFER *next;
+
+	dis_interrupts(DI_SPI);
+	ESIOF0 = 0;		QSIOF0 = 0;
+	// discard asynchronous transfers
+	xfer = _spi_xfer_head;
+	if(_spi_xfer_active && (xfer->cs != SPI_CS_NONE)) digitalWrite(xfer->cs, HIGH);
+	if(_spi_xfer_active) lp_removeConstraint(LP_NEED_HSCLK);
+	_spi_xfer_head = NULL;
+	_spi_xfer_tail = NULL;
+	_spi_xfer_count = 0;
+	_spi_xfer_active = false;
+	_spi_owned = false;
+	_spi_enabled = false;
+	enb_interrupts(DI_SPI);
 	set_bit(DSIOF0);			// BLKCON  SPI disenable
+
+	// complete discarded transfers with error. submit in callback fails because SPI is stopped.
+	while(xfer != NULL)
+	{
+		next = xfer->next;
+		xfer->result = SPI_RESULT_ERROR;
+		if(xfer->callback) xfer->callback(xfer);
+		xfer = next;
+	}
 }
 
 static void _spi_setBitOrder(uint8_t bo)
@@ -143,3 +439,135 @@ static void _spi_setClockDivider(UINT16 ckdiv)
 	_spi_brr = ckdiv;
 }
 
+// transfer len bytes. 2 bytes are packed in a 16bit frame, and FIFO is filled in each step.
+static void _spi_transferBuffer(const uint8_t *tx, uint8_t *rx, uint16_t len)
+{
+	if(_spi_xfer_active) _spi_wait_async();
+	_spi_job.tx = tx;
+	_spi_job.rx = rx;
+	_spi_job.remain = len;
+	while(_spi_job.remain != 0)
+	{
+		_spi_job_load();
+		while(get_bit(SF0SPIF)==0)
+		{
+			continue;
+		}
+		_spi_job_unload();
+	}
+}
+
+// send 16bit pattern count times in the bit order. rx data is discarded.
+static void _spi_writeRepeat(uint16_t pattern, uint32_t count)
+{
+	UINT16 frame[SPI_FIFO_DEPTH];
+	uint8_t i, n;
+
+	if(_spi_xfer_active) _spi_wait_async();
+	_spi_set_frame16(true);
+	while(count)
+	{
+		n = (count > SPI_FIFO_DEPTH) ? SPI_FIFO_DEPTH : (uint8_t)count;
+		for(i = 0; i < n; i++)
+		{
+			frame[i] = pattern;
+		}
+		_spi_fifo_run(frame, n);
+		count -= n;
+	}
+}
+
+static void _spi_readInto(uint8_t *buf, uint16_t len)
+{
+	_spi_transferBuffer(NULL, buf, len);
+}
+
+// hold bus for a device and apply its settings.
+// asynchronous transfers are completed before, and are not started until endTransaction().
+// settings = NULL : settings of begin() is used
+static void _spi_beginTransaction(const SPISettings *settings)
+{
+	// already held. only settings are changed
+	if(_spi_owned)
+	{
+		if(settings != NULL) _spi_apply(settings->ctrl, settings->brr);
+		return;
+	}
+	for(;;)
+	{
+		dis_interrupts(DI_SPI);
+		if(!_spi_xfer_active) break;
+		enb_interrupts(DI_SPI);
+		_spi_wait_async();
+	}
+	_spi_owned = true;
+	enb_interrupts(DI_SPI);
+
+	if(settings != NULL) _spi_apply(settings->ctrl, settings->brr);
+	else _spi_apply(_spi_ctrl, _spi_brr);
+}
+
+// release bus and start asynchronous transfers queued while bus is held
+static void _spi_endTransaction(void)
+{
+	dis_interrupts(DI_SPI);
+	if(_spi_owned)
+	{
+		_spi_owned = false;
+		if((_spi_xfer_head != NULL) && !_spi_xfer_active) _spi_xfer_start();
+		else _spi_apply(_spi_ctrl, _spi_brr);
+	}
+	enb_interrupts(DI_SPI);
+}
+
+// queue asynchronous transfer
+// transfer is started immediately when bus is free, and following transfers
+// are started in interrupt one by one.
+// return = false : parameter error or SPI is not started
+static BOOLEAN _spi_submit(SPI_XFER *xfer)
+{
+	bool lock;
+
+	if((xfer == NULL) || (xfer->len == 0) || !_spi_enabled) return false;
+
+	xfer->result = SPI_RESULT_BUSY;
+	xfer->next = NULL;
+
+	lock = !_spi_xfer_callback;		// interrupt is already disabled in callback
+	if(lock) dis_interrupts(DI_SPI);
+	if(_spi_xfer_head == NULL)
+	{
+		_spi_xfer_head = xfer;
+		_spi_xfer_tail = xfer;
+		_spi_xfer_count = 1;
+		if(!_spi_owned) _spi_xfer_start();
+	}
+	else
+	{
+		_spi_xfer_tail->next = xfer;
+		_spi_xfer_tail = xfer;
+		_spi_xfer_count++;
+	}
+	if(lock) enb_interrupts(DI_SPI);
+
+	return true;
+}
+
+// return = number of transfers not completed
+// queue is processed here when interrupt is not available
+static uint8_t _spi_poll(void)
+{
+	if(_spi_xfer_active && (getMIE() == 0))
+	{
+		_spi_isr();
+		QSIOF0 = 0;
+	}
+	else if(_spi_xfer_active && !_spi_use_irq)
+	{
+		dis_interrupts(DI_SPI);
+		_spi_isr();
+		QSIOF0 = 0;
+		enb_interrupts(DI_SPI);
+	}
+	return _spi_xfer_count;
+}
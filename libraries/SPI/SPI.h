@@ -44,6 +44,33 @@
 #define SPI_MODE_MASK 		0x60	// SPR1 = bit 1, SPR0 = bit 0 on SPCR
 #define SPI_MSBFIRST		0x10	// 1: MSBFIRST,  0: LSBFIRST(default)
 
+#define SPI_CS_NONE			0xFF	// chip select is not controlled by driver
+
+#define SPI_RESULT_OK		0
+#define SPI_RESULT_ERROR	1		// transfer is discarded by end()
+#define SPI_RESULT_BUSY		0xFF	// asynchronous transfer is not completed
+
+// settings of a device, applied by beginTransaction() or asynchronous transfer
+// ex. const SPISettings feram = SPI_SETTINGS(SPI_CLOCK_DIV4, MSBFIRST, SPI_MODE0);
+typedef struct {
+	UINT16	brr;							// SPI_CLOCK_DIVx
+	UCHAR	ctrl;							// SPI_MODEx | SPI_MSBFIRST
+} SPISettings;
+#define SPI_SETTINGS(div, order, mode)	{ (UINT16)(div), (UCHAR)((((order) == LSBFIRST) ? 0 : SPI_MSBFIRST) | (mode)) }
+
+// descriptor of asynchronous transfer
+// descriptor, settings and buffers must be kept by caller until the transfer is completed.
+typedef struct _SPI_XFER {
+	UCHAR	cs;								// chip select pin. SPI_CS_NONE = not controlled
+	const SPISettings *settings;			// NULL = settings of begin()
+	const uint8_t *tx_buf;					// NULL = send 0xFF
+	uint8_t	*rx_buf;						// NULL = discard receiving data
+	UINT16	len;							// length of transfer. must not be 0
+	void	(*callback)(struct _SPI_XFER *xfer);	// called in interrupt when completed, or by end(). NULL is available
+	volatile UCHAR	result;					// SPI_RESULT_xxx. SPI_RESULT_BUSY until completion
+	struct _SPI_XFER *next;					// used by driver
+} SPI_XFER;
+
 //********************************************************************************
 //   global parameters
 //********************************************************************************
@@ -57,6 +84,13 @@ typedef struct {
 	void (*setBitOrder)(uint8_t);
 	void (*setDataMode)(uint8_t);
 	void (*setClockDivider)(UINT16 ckdiv);
+	void (*transferBuffer)(const uint8_t *tx, uint8_t *rx, uint16_t len);	// tx=NULL: send 0xFF, rx=NULL: discard
+	void (*writeRepeat)(uint16_t pattern, uint32_t count);	// send 16bit pattern count times
+	void (*readInto)(uint8_t *buf, uint16_t len);	// receive len bytes sending 0xFF
+	void (*beginTransaction)(const SPISettings *settings);	// hold bus and apply settings. NULL = settings of begin()
+	void (*endTransaction)(void);
+	BOOLEAN (*submit)(SPI_XFER *xfer);		// queue asynchronous transfer
+	uint8_t (*poll)(void);					// number of asynchronous transfers not completed
 } SPIClass;
 
 //********************************************************************************
@@ -51,6 +51,7 @@ OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "TFT.h"
 #include "SPI.h"
+#include "driver_pin_assignment.h"
 #include "glcdfont.c"
 
 //********************************************************************************
@@ -101,6 +102,9 @@ void line(int16_t x1, int16_t y1, int16_t x2, int16_t y2);
 void rect(int16_t x, int16_t y, int16_t width, int16_t height, int16_t radius);
 void circle(int16_t x, int16_t y, int16_t r);
 void triangle(int16_t x1, int16_t y1, int16_t x2, int16_t y2, int16_t x3, int16_t y3);
+void setScene(void (*render)(int16_t x, int16_t y, int16_t w, int16_t h), uint16_t bg);
+void invalidate(int16_t x, int16_t y, int16_t w, int16_t h);
+void flush(void);
 
 const t_TFT tft = {
 	begin,
@@ -147,7 +151,10 @@ const t_TFT tft = {
 	point,
 	line,
 	rect,
-	triangle
+	triangle,
+	setScene,
+	invalidate,
+	flush
 };
 
 //********************************************************************************
@@ -155,11 +162,29 @@ const t_TFT tft = {
 //********************************************************************************
 #define pgm_read_byte(addr) (*(const unsigned char *)(addr))
 
+// RS is switched by writing the port register directly
+#define RS_COMMAND()	(*_rs_port &= (uint8_t)~_rs_bit)
+#define RS_DATA()		(*_rs_port |= _rs_bit)
+
+#define TFT_SPAN_BUF	64			// bytes of pixel data streamed at once by drawChar
+
+// dirty tile map. bit (ty * tiles_x + tx) is set when tile (tx, ty) must be redrawn
+#define TFT_TILES		((ST7735_TFTWIDTH >> TFT_TILE_SHIFT) * (ST7735_TFTHEIGHT >> TFT_TILE_SHIFT))
+
 //********************************************************************************
 //   local parameters
 //********************************************************************************
 uint8_t tabcolor;
 uint8_t _cs, _rs, _rst, colstart, rowstart; // some displays need this changed
+static volatile uint8_t *_cs_port, *_rs_port;
+static uint8_t _cs_bit, _rs_bit;
+static uint8_t _select_depth;	// nesting of spiselect()
+static boolean _clipping;		// drawing is limited to the clip rectangle during flush()
+static int16_t _clip_x0, _clip_y0, _clip_x1, _clip_y1;
+static uint8_t _dirty[(TFT_TILES + 7) / 8];
+static void (*_scene_render)(int16_t x, int16_t y, int16_t w, int16_t h);
+static uint16_t _scene_bg;
+const SPISettings tft_spi = SPI_SETTINGS(SPI_CLOCK_DIV4, MSBFIRST, SPI_MODE0);
 int16_t WIDTH, HEIGHT;		// this is the 'raw' display w/h - never changes
 int16_t _width, _height;	// dependent on rotation
 int16_t cursor_x, cursor_y;
@@ -178,10 +203,18 @@ bool useFill;
 uint16_t swapcolor(uint16_t x);
 void Adafruit_ST7735(uint8_t cs, uint8_t rs, uint8_t rst);
 void spiwrite(uint8_t c);
+void spiselect(void);
+void spideselect(void);
 void writecommand(uint8_t c);
 void writedata(uint8_t c);
 void commandList(const uint8_t *addr);
 void commonInit(const uint8_t *cmdList);
+uint16_t panelcolor(uint16_t c);
+void writeAddrWindow(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1);
+void fillWindow(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+void getClip(int16_t *x0, int16_t *y0, int16_t *x1, int16_t *y1);
+boolean testDirty(int16_t tx, int16_t ty);
+void clearDirty(int16_t tx, int16_t ty);
 void Adafruit_GFX(int16_t w, int16_t h);
 void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
 size_t write_print(const uint8_t *buffer, size_t size);
@@ -217,6 +250,11 @@ void Adafruit_ST7735(uint8_t cs, uint8_t rs, uint8_t rst)
 	_cs   = cs;
 	_rs   = rs;
 	_rst  = rst;
+	_cs_port = (volatile uint8_t *)ml620504f_pin_to_port[digital_pin_to_port[cs]];
+	_cs_bit  = ml620504f_pin_to_bit[digital_pin_to_port[cs]];
+	_rs_port = (volatile uint8_t *)ml620504f_pin_to_port[digital_pin_to_port[rs]];
+	_rs_bit  = ml620504f_pin_to_bit[digital_pin_to_port[rs]];
+	_select_depth = 0;
 }
 
 void spiwrite(uint8_t c)
@@ -224,20 +262,38 @@ void spiwrite(uint8_t c)
 	SPI.transfer(c);
 }
 
+// hold SPI bus with settings of ST7735 and select the device
+// calls may be nested. the device is released by the outermost spideselect()
+void spiselect(void)
+{
+	if (_select_depth++ == 0) {
+		SPI.beginTransaction(&tft_spi);
+		*_cs_port &= (uint8_t)~_cs_bit;
+	}
+}
+
+void spideselect(void)
+{
+	if (--_select_depth == 0) {
+		*_cs_port |= _cs_bit;
+		SPI.endTransaction();
+	}
+}
+
 void writecommand(uint8_t c) 
 {
-	digitalWrite(_rs, LOW);
-	digitalWrite(_cs, LOW);
+	RS_COMMAND();
+	spiselect();
 	spiwrite(c);
-	digitalWrite(_cs, HIGH);
+	spideselect();
 }
 
 void writedata(uint8_t c) 
 {
-	digitalWrite(_rs, HIGH);
-	digitalWrite(_cs, LOW);
+	RS_DATA();
+	spiselect();
 	spiwrite(c);
-	digitalWrite(_cs, HIGH);
+	spideselect();
 }
 
 // Rather than a bazillion writecommand() and writedata() calls, screen
@@ -503,33 +559,96 @@ void initR(uint8_t options) {
 	tabcolor = options;
 }
 
-void setAddrWindow(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1) 
+// set address window and start RAM write. the device must be selected by spiselect().
+// RS is left at data, so pixel data can follow directly.
+void writeAddrWindow(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1)
 {
-	writecommand(ST7735_CASET);				// Column addr set
-	writedata(0x00);
-	writedata((uint8_t)(x0+colstart));		// XSTART 
-	writedata(0x00);
-	writedata((uint8_t)(x1+colstart));		// XEND
+	uint8_t buf[4];
+
+	buf[0] = 0x00;
+	buf[1] = (uint8_t)(x0+colstart);		// XSTART
+	buf[2] = 0x00;
+	buf[3] = (uint8_t)(x1+colstart);		// XEND
+	RS_COMMAND();
+	spiwrite(ST7735_CASET);					// Column addr set
+	RS_DATA();
+	SPI.transferBuffer(buf, NULL, 4);
+
+	buf[1] = (uint8_t)(y0+rowstart);		// YSTART
+	buf[3] = (uint8_t)(y1+rowstart);		// YEND
+	RS_COMMAND();
+	spiwrite(ST7735_RASET);					// Row addr set
+	RS_DATA();
+	SPI.transferBuffer(buf, NULL, 4);
+
+	RS_COMMAND();
+	spiwrite(ST7735_RAMWR);					// write to RAM
+	RS_DATA();
+}
 
-	writecommand(ST7735_RASET);				// Row addr set
-	writedata(0x00);
-	writedata((uint8_t)(y0+rowstart));		// YSTART
-	writedata(0x00);
-	writedata((uint8_t)(y1+rowstart));		// YEND
+// color in the byte order of the panel
+uint16_t panelcolor(uint16_t c)
+{
+	return (tabcolor == INITR_BLACKTAB) ? swapcolor(c) : c;
+}
 
-	writecommand(ST7735_RAMWR);				// write to RAM
+// drawable area: the screen, or the rectangle being redrawn by flush()
+void getClip(int16_t *x0, int16_t *y0, int16_t *x1, int16_t *y1)
+{
+	if (_clipping) {
+		*x0 = _clip_x0;
+		*y0 = _clip_y0;
+		*x1 = _clip_x1;
+		*y1 = _clip_y1;
+	} else {
+		*x0 = 0;
+		*y0 = 0;
+		*x1 = _width;
+		*y1 = _height;
+	}
 }
 
-void pushColor(uint16_t color) 
+// clip the rectangle and fill it with one address window.
+// the device must be selected and color must be converted by panelcolor().
+void fillWindow(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
 {
-	digitalWrite(_rs, HIGH);
-	digitalWrite(_cs, LOW);
+	int16_t x0, y0, x1, y1;
 
-	if (tabcolor == INITR_BLACKTAB)   color = swapcolor(color);
-	spiwrite((uint8_t)(color >> 8));
-	spiwrite((uint8_t)(color));
+	getClip(&x0, &y0, &x1, &y1);
+	if (x < x0) {
+		w -= x0 - x;
+		x = x0;
+	}
+	if (y < y0) {
+		h -= y0 - y;
+		y = y0;
+	}
+	if ((x + w) > x1) {
+		w = x1 - x;
+	}
+	if ((y + h) > y1) {
+		h = y1 - y;
+	}
+	if ((w <= 0) || (h <= 0)) {
+		return;
+	}
+	writeAddrWindow((uint8_t)x, (uint8_t)y, (uint8_t)(x+w-1), (uint8_t)(y+h-1));
+	SPI.writeRepeat(color, (uint32_t)w * h);
+}
 
-	digitalWrite(_cs, HIGH);
+void setAddrWindow(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1) 
+{
+	spiselect();
+	writeAddrWindow(x0, y0, x1, y1);
+	spideselect();
+}
+
+void pushColor(uint16_t color) 
+{
+	RS_DATA();
+	spiselect();
+	SPI.writeRepeat(panelcolor(color), 1);
+	spideselect();
 }
 
 void drawPixel(int16_t x, int16_t y, uint16_t color) 
@@ -537,67 +656,23 @@ void drawPixel(int16_t x, int16_t y, uint16_t color)
 	if((x < 0) ||(x >= _width) || (y < 0) || (y >= _height)) {
 		return;
 	}
-	setAddrWindow((uint8_t)x, (uint8_t)y, (uint8_t)(x+1), (uint8_t)(y+1));
-	digitalWrite(_rs, HIGH);
-	digitalWrite(_cs, LOW);
-	if (tabcolor == INITR_BLACKTAB) {
-		color = swapcolor(color);
-	}
-	spiwrite((uint8_t)(color >> 8));
-	spiwrite((uint8_t)color);
-	digitalWrite(_cs, HIGH);
+	spiselect();
+	fillWindow(x, y, 1, 1, panelcolor(color));
+	spideselect();
 }
 
 void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color)
 {
-	uint8_t hi,lo;
-	// Rudimentary clipping
-	if((x >= _width) || (y >= _height)) {
-		return;
-	}
-	if((y+h-1) >= _height) {
-		h = _height-y;
-	}
-	setAddrWindow((uint8_t)x, (uint8_t)y, (uint8_t)x, (uint8_t)(y+h-1));
-	
-	if (tabcolor == INITR_BLACKTAB) {
-		color = swapcolor(color);
-	}
-	hi = (uint8_t)(color >> 8);
-	lo = (uint8_t)color;
-	digitalWrite(_rs, HIGH);
-	digitalWrite(_cs, LOW);
-	while (h--) {
-		spiwrite(hi);
-		spiwrite(lo);
-	}
-	digitalWrite(_cs, HIGH);
+	spiselect();
+	fillWindow(x, y, 1, h, panelcolor(color));
+	spideselect();
 }
 
 void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color)
 {
-	uint8_t hi, lo;
-	// Rudimentary clipping
-	if((x >= _width) || (y >= _height)) {
-		return;
-	}
-	if((x+w-1) >= _width)  {
-		w = _width-x;
-	}
-	setAddrWindow((uint8_t)x, (uint8_t)y, (uint8_t)(x+w-1), (uint8_t)y);
-	if (tabcolor == INITR_BLACKTAB) {
-		color = swapcolor(color);
-	}
-	hi = (uint8_t)(color >> 8);
-	lo = (uint8_t)color;
-
-	digitalWrite(_rs, HIGH);
-	digitalWrite(_cs, LOW);
-	while (w--) {
-		spiwrite(hi);
-		spiwrite(lo);
-	}
-	digitalWrite(_cs, HIGH);
+	spiselect();
+	fillWindow(x, y, w, 1, panelcolor(color));
+	spideselect();
 }
 
 void fillScreen(uint16_t color) {
@@ -607,35 +682,9 @@ void fillScreen(uint16_t color) {
 // fill a rectangle
 void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) 
 {
-	uint8_t hi, lo;
-	// rudimentary clipping (drawChar w/big text requires this)
-	if((x >= _width) || (y >= _height)) {
-		return;
-	}
-	if((x + w - 1) >= _width) {
-		w = _width  - x;
-	}
-	if((y + h - 1) >= _height) {
-		h = _height - y;
-	}
-	if (tabcolor == INITR_BLACKTAB) {
-		color = swapcolor(color);
-	}
-	setAddrWindow((uint8_t)x, (uint8_t)y, (uint8_t)(x+w-1), (uint8_t)(y+h-1));
-
-	hi = (uint8_t)(color >> 8);
-	lo = (uint8_t)color;
-
-	digitalWrite(_rs, HIGH);
-	digitalWrite(_cs, LOW);
-  
-	for(y=h; y>0; y--) {
-		for(x=w; x>0; x--) {
-			spiwrite(hi);
-			spiwrite(lo);
-		}
-	}
-	digitalWrite(_cs, HIGH);
+	spiselect();
+	fillWindow(x, y, w, h, panelcolor(color));
+	spideselect();
 }
 
 #define MADCTL_MY  0x80
@@ -673,6 +722,8 @@ void setRotation(uint8_t m)
 	default:
 		break;
 	}
+	// tile layout follows the orientation. the whole scene has to be redrawn
+	memset(_dirty, 0xff, sizeof(_dirty));
 }
 
 void invertDisplay(boolean i)
@@ -708,6 +759,7 @@ void drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color)
 	int16_t x = 0;
 	int16_t y = r;
 
+	spiselect();
 	drawPixel(x0, y0+r, color);
 	drawPixel(x0, y0-r, color);
 	drawPixel(x0+r, y0, color);
@@ -732,6 +784,7 @@ void drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color)
 		drawPixel(x0 + y, y0 - x, color);
 		drawPixel(x0 - y, y0 - x, color);
 	}
+	spideselect();
 }
 
 void drawCircleHelper( int16_t x0, int16_t y0, int16_t r, uint8_t cornername, uint16_t color)
@@ -742,6 +795,7 @@ void drawCircleHelper( int16_t x0, int16_t y0, int16_t r, uint8_t cornername, ui
 	int16_t x     = 0;
 	int16_t y     = r;
 
+	spiselect();
 	while (x<y) {
 		if (f >= 0) {
 			y--;
@@ -768,12 +822,15 @@ void drawCircleHelper( int16_t x0, int16_t y0, int16_t r, uint8_t cornername, ui
 			drawPixel(x0 - x, y0 - y, color);
 		}
 	}
+	spideselect();
 }
 
 void fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color)
 {
+	spiselect();
 	drawFastVLine(x0, y0-r, 2*r+1, color);
 	fillCircleHelper(x0, y0, r, 3, 0, color);
+	spideselect();
 }
 
 // used to do circles and roundrects
@@ -786,6 +843,7 @@ void fillCircleHelper(int16_t x0, int16_t y0, int16_t r,
 	int16_t x     = 0;
 	int16_t y     = r;
 
+	spiselect();
 	while (x<y) {
 		if (f >= 0) {
 			y--;
@@ -804,6 +862,7 @@ void fillCircleHelper(int16_t x0, int16_t y0, int16_t r,
 			drawFastVLine(x0-y, y0-x, 2*x+1+delta, color);
 		}
 	}
+	spideselect();
 }
 
 // Bresenham's algorithm - thx wikpedia
@@ -833,6 +892,7 @@ void drawLine(int16_t x0, int16_t y0,
 	} else {
 		ystep = -1;
 	}
+	spiselect();
 	for (; x0<=x1; x0++) {
 		if (steep) {
 			drawPixel(y0, x0, color);
@@ -845,22 +905,26 @@ void drawLine(int16_t x0, int16_t y0,
 			err += dx;
 		}
 	}
+	spideselect();
 }
 
 
 // Draw a rectangle
 void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
 {
+	spiselect();
 	drawFastHLine(x, y, w, color);
 	drawFastHLine(x, y+h-1, w, color);
 	drawFastVLine(x, y, h, color);
 	drawFastVLine(x+w-1, y, h, color);
+	spideselect();
 }
 
 // Draw a rounded rectangle
 void drawRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color)
 {
 	// smarter version
+	spiselect();
 	drawFastHLine(x+r  , y    , w-2*r, color); // Top
 	drawFastHLine(x+r  , y+h-1, w-2*r, color); // Bottom
 	drawFastVLine(x    , y+r  , h-2*r, color); // Left
@@ -870,16 +934,19 @@ void drawRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16
 	drawCircleHelper(x+w-r-1, y+r    , r, 2, color);
 	drawCircleHelper(x+w-r-1, y+h-r-1, r, 4, color);
 	drawCircleHelper(x+r    , y+h-r-1, r, 8, color);
+	spideselect();
 }
 
 // Fill a rounded rectangle
 void fillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color)
 {
 	// smarter version
+	spiselect();
 	fillRect(x+r, y, w-2*r, h, color);
 	// draw four corners
 	fillCircleHelper(x+w-r-1, y+r, r, 1, h-2*r-1, color);
 	fillCircleHelper(x+r    , y+r, r, 2, h-2*r-1, color);
+	spideselect();
 }
 
 // Draw a triangle
@@ -887,9 +954,11 @@ void drawTriangle(int16_t x0, int16_t y0,
 				int16_t x1, int16_t y1, 
 				int16_t x2, int16_t y2, uint16_t color) 
 {
+	spiselect();
 	drawLine(x0, y0, x1, y1, color);
 	drawLine(x1, y1, x2, y2, color);
 	drawLine(x2, y2, x0, y0, color);
+	spideselect();
 }
 
 // Fill a triangle
@@ -921,6 +990,8 @@ void fillTriangle ( int16_t x0, int16_t y0,
 		return;
 	}
 
+	spiselect();
+
 	dx01 = x1 - x0,
 	dy01 = y1 - y0,
 	dx02 = x2 - x0,
@@ -968,19 +1039,32 @@ void fillTriangle ( int16_t x0, int16_t y0,
 		if(a > b) swap(a,b);
 		drawFastHLine(a, y, b-a+1, color);
 	}
+	spideselect();
 }
 
 void drawBitmap(int16_t x, int16_t y, 
 				const uint8_t *bitmap, int16_t w, int16_t h, uint16_t color) 
 {
-	int16_t i, j, byteWidth = (w + 7) / 8;
+	int16_t i, j, run, byteWidth = (w + 7) / 8;
+
+	// each horizontal run of set bits is sent as one address window
+	color = panelcolor(color);
+	spiselect();
 	for(j=0; j<h; j++) {
-		for(i=0; i<w; i++ ) {
-			if(pgm_read_byte(bitmap + j * byteWidth + i / 8) & (128 >> (i & 7))) {
-				drawPixel(x+i, y+j, color);
+		for(i=0; i<w; i+=run) {
+			run = 0;
+			while(((i + run) < w) &&
+				  (pgm_read_byte(bitmap + j * byteWidth + (i + run) / 8) & (128 >> ((i + run) & 7)))) {
+				run++;
+			}
+			if(run) {
+				fillWindow(x+i, y+j, run, 1, color);
+			} else {
+				run = 1;
 			}
 		}
 	}
+	spideselect();
 }
 
 size_t write(uint8_t c) {
@@ -1004,37 +1088,65 @@ size_t write(uint8_t c) {
 void drawChar(int16_t x, int16_t y, unsigned char c,
 			    uint16_t color, uint16_t bg, uint8_t size) 
 {
-	int8_t i,j;
+	uint8_t glyph[6];
+	uint8_t buf[TFT_SPAN_BUF];
+	uint8_t mask, on, n;
+	int16_t i, j, run;
+	int16_t w = 6 * size, h = 8 * size;
+	int16_t x0, y0, x1, y1;
+	uint16_t pixel;
+
 	if((x >= _width)				|| // Clip right
 		(y >= _height)				|| // Clip bottom
-		((x + 6 * size - 1) < 0)	|| // Clip left
-		((y + 8 * size - 1) < 0))     // Clip top
+		((x + w - 1) < 0)			|| // Clip left
+		((y + h - 1) < 0))			// Clip top
 		return;
 
-	for (i=0; i<6; i++ ) {
-		uint8_t line;
-		if (i == 5) {
-			line = 0x0;
-		} else {
-			line = pgm_read_byte(font+(c*5)+i);
+	for (i=0; i<5; i++) {
+		glyph[i] = pgm_read_byte(font+(c*5)+i);
+	}
+	glyph[5] = 0x0;
+	color = panelcolor(color);
+	bg = panelcolor(bg);
+
+	getClip(&x0, &y0, &x1, &y1);
+	spiselect();
+	if ((bg != color) && (x >= x0) && (y >= y0) && ((x + w) <= x1) && ((y + h) <= y1)) {
+		// opaque and fully visible: one address window, pixels streamed row by row
+		writeAddrWindow((uint8_t)x, (uint8_t)y, (uint8_t)(x+w-1), (uint8_t)(y+h-1));
+		n = 0;
+		for (j=0; j<h; j++) {
+			mask = (uint8_t)(1 << (j / size));
+			for (i=0; i<w; i++) {
+				pixel = (glyph[i / size] & mask) ? color : bg;
+				buf[n++] = (uint8_t)(pixel >> 8);
+				buf[n++] = (uint8_t)(pixel & 0xff);
+				if (n == TFT_SPAN_BUF) {
+					SPI.transferBuffer(buf, NULL, n);
+					n = 0;
+				}
+			}
 		}
-		for (j = 0; j<8; j++) {
-			if (line & 0x1) {
-				if (size == 1) { // default size
-					drawPixel(x+i, y+j, color);
-				} else {  // big size
-					fillRect(x+(i*size), y+(j*size), size, size, color);
-				} 
-			} else if (bg != color) {
-				if (size == 1) {// default size
-					drawPixel(x+i, y+j, bg);
-				} else {  // big size
-					fillRect(x+i*size, y+j*size, size, size, bg);
+		if (n) SPI.transferBuffer(buf, NULL, n);
+	} else {
+		// transparent or clipped: one address window per horizontal run
+		for (j=0; j<8; j++) {
+			mask = (uint8_t)(1 << j);
+			for (i=0; i<6; i+=run) {
+				on = glyph[i] & mask;
+				run = 1;
+				while (((i + run) < 6) && ((glyph[i + run] & mask) == on)) {
+					run++;
+				}
+				if (on) {
+					fillWindow(x+i*size, y+j*size, run*size, size, color);
+				} else if (bg != color) {
+					fillWindow(x+i*size, y+j*size, run*size, size, bg);
 				}
 			}
-			line >>= 1;
 		}
 	}
+	spideselect();
 }
 
 void setCursor(int16_t x, int16_t y) 
@@ -1212,6 +1324,7 @@ void triangle(int16_t x1, int16_t y1, int16_t x2, int16_t y2, int16_t x3, int16_
 size_t write_print(const uint8_t *buffer, size_t size)
 {
 	size_t n = 0;
+	spiselect();
 	while (size--) {
 		if (write(*buffer++)) {
 			n++;
@@ -1219,6 +1332,7 @@ size_t write_print(const uint8_t *buffer, size_t size)
 			break;
 		}
 	}
+	spideselect();
 	return n;
 }
 
@@ -1227,3 +1341,103 @@ void print_text(const char str[])
 	write_print(str, strlen(str));
 }
 
+
+// render is called by flush() for each rectangle to redraw, after the rectangle
+// has been cleared with bg. drawing is clipped to the rectangle while it runs.
+// render = NULL only clears invalidated areas.
+void setScene(void (*render)(int16_t x, int16_t y, int16_t w, int16_t h), uint16_t bg)
+{
+	_scene_render = render;
+	_scene_bg = bg;
+}
+
+boolean testDirty(int16_t tx, int16_t ty)
+{
+	int16_t n = ty * (_width >> TFT_TILE_SHIFT) + tx;
+	return (_dirty[n >> 3] & (1 << (n & 7))) ? true : false;
+}
+
+void clearDirty(int16_t tx, int16_t ty)
+{
+	int16_t n = ty * (_width >> TFT_TILE_SHIFT) + tx;
+	_dirty[n >> 3] &= (uint8_t)~(1 << (n & 7));
+}
+
+// mark an area to be redrawn by the next flush()
+void invalidate(int16_t x, int16_t y, int16_t w, int16_t h)
+{
+	int16_t tx, ty, tx1, ty1, n;
+
+	if (x < 0) {
+		w += x;
+		x = 0;
+	}
+	if (y < 0) {
+		h += y;
+		y = 0;
+	}
+	if ((x + w) > _width) {
+		w = _width - x;
+	}
+	if ((y + h) > _height) {
+		h = _height - y;
+	}
+	if ((w <= 0) || (h <= 0)) {
+		return;
+	}
+	tx1 = (x + w - 1) >> TFT_TILE_SHIFT;
+	ty1 = (y + h - 1) >> TFT_TILE_SHIFT;
+	for (ty = y >> TFT_TILE_SHIFT; ty <= ty1; ty++) {
+		for (tx = x >> TFT_TILE_SHIFT; tx <= tx1; tx++) {
+			n = ty * (_width >> TFT_TILE_SHIFT) + tx;
+			_dirty[n >> 3] |= (uint8_t)(1 << (n & 7));
+		}
+	}
+}
+
+// redraw invalidated areas. a horizontal run of dirty tiles is grown downward
+// while the rows below are dirty over the same run, and each resulting
+// rectangle is cleared with one address window and then rendered.
+void flush(void)
+{
+	int16_t tiles_x = _width >> TFT_TILE_SHIFT;
+	int16_t tiles_y = _height >> TFT_TILE_SHIFT;
+	int16_t tx, ty, tx0, tx1, ty1, i;
+	uint16_t bg = panelcolor(_scene_bg);
+
+	spiselect();
+	for (ty = 0; ty < tiles_y; ty++) {
+		for (tx = 0; tx < tiles_x; ) {
+			if (!testDirty(tx, ty)) {
+				tx++;
+				continue;
+			}
+			tx0 = tx;
+			while ((tx < tiles_x) && testDirty(tx, ty)) {
+				clearDirty(tx, ty);
+				tx++;
+			}
+			tx1 = tx;
+			for (ty1 = ty + 1; ty1 < tiles_y; ty1++) {
+				for (i = tx0; i < tx1; i++) {
+					if (!testDirty(i, ty1)) break;
+				}
+				if (i < tx1) break;
+				for (i = tx0; i < tx1; i++) {
+					clearDirty(i, ty1);
+				}
+			}
+			_clip_x0 = tx0 << TFT_TILE_SHIFT;
+			_clip_y0 = ty << TFT_TILE_SHIFT;
+			_clip_x1 = tx1 << TFT_TILE_SHIFT;
+			_clip_y1 = ty1 << TFT_TILE_SHIFT;
+			_clipping = true;
+			fillWindow(_clip_x0, _clip_y0, _clip_x1 - _clip_x0, _clip_y1 - _clip_y0, bg);
+			if (_scene_render) {
+				_scene_render(_clip_x0, _clip_y0, _clip_x1 - _clip_x0, _clip_y1 - _clip_y0);
+			}
+			_clipping = false;
+		}
+	}
+	spideselect();
+}
@@ -75,6 +75,10 @@ typedef struct {
 	void (*line)(int16_t x1, int16_t y1, int16_t x2, int16_t y2);
 	void (*rect)(int16_t x, int16_t y, int16_t width, int16_t height, int16_t radius);
 	void (*triangle)(int16_t x1, int16_t y1, int16_t x2, int16_t y2, int16_t x3, int16_t y3);
+	/* partial update */
+	void (*setScene)(void (*render)(int16_t x, int16_t y, int16_t w, int16_t h), uint16_t bg);
+	void (*invalidate)(int16_t x, int16_t y, int16_t w, int16_t h);
+	void (*flush)(void);
 } t_TFT;
 
 t_TFT TFT(uint8_t CS, uint8_t RS, uint8_t RST);
@@ -97,6 +101,10 @@ extern const t_TFT tft;
 #define ST7735_TFTWIDTH  128
 #define ST7735_TFTHEIGHT 160
 
+// invalidate()/flush() track changes in tiles of 8x8 pixels
+#define TFT_TILE_SHIFT   3
+#define TFT_TILE_SIZE    (1 << TFT_TILE_SHIFT)
+
 #define ST7735_NOP     0x00
 #define ST7735_SWRESET 0x01
 #define ST7735_RDDID   0x04
@@ -24,6 +24,8 @@
 #include "lazurite.h"
 #include "wire.h"
 #include "driver_i2c.h"
+#include "driver_irq.h"
+#include "lp_manage.h"
 #include <stdlib.h>
 #include <stddef.h>
 
@@ -50,7 +52,6 @@ static struct {
 	WIRE_PARAM rx;
 } wire;
 //static BOOL delay_status;
-static uint16_t timeout=0;
 //********************************************************************************
 //   local function definitions
 //********************************************************************************
@@ -60,12 +61,33 @@ static uint16_t timeout=0;
 //********************************************************************************
 // Arduino compatible I2C ( by I2C1)
 
+// wait until asynchronous transactions are completed, and recover bus after timeout
+// synchronous sequence must not be mixed with asynchronous transactions
+// pending is checked with I2C interrupt disabled, so that completion is not lost before HALT
+static void _wire_wait_async(void)
+{
+	BOOLEAN pending;
+
+	do {
+		i2c_poll(1);
+		if(getMIE() == 0) {
+			pending = (i2c_xfer_pending(1) != 0);
+			if(pending) di_wait();
+		} else {
+			dis_interrupts(DI_I2C);
+			pending = (i2c_xfer_pending(1) != 0);
+			if(pending) lp_idle();
+			enb_interrupts(DI_I2C);
+		}
+	} while(pending);
+}
+
 // Initializing I2C hardware & reset parameter
 static void _wire_begin(void)
 {
 	i2c_init(1);
 	i2c_begin(1);
-	timeout=0;
+	i2c_set_timeout(1,I2C_TIMEOUT_DEFAULT);
 	return;
 }
 
@@ -109,6 +131,8 @@ static size_t _wire_write_byte(uint8_t data)
 
 static uint8_t _wire_endTransmission(uint8_t sendStop)
 {
+	_wire_wait_async();
+
 	// set tx pointer
 	i2c_set_tx_buf(1,wire.tx.buffer,wire.tx.length);
 
@@ -116,7 +140,7 @@ static uint8_t _wire_endTransmission(uint8_t sendStop)
 	i2c_start(1,true,sendStop);
 	
 	// wait end of communication
-	HALT_Until_Event(HALT_I2C1_END,timeout);
+	HALT_Until_Event(HALT_I2C1_END,0);				// bounded by timeout of driver
 	
 	wire.tx.index = 0;
 	wire.tx.length = 0;
@@ -132,6 +156,8 @@ static size_t _wire_requestFrom(UCHAR address,UCHAR quantity, UCHAR sendStop)
 	{
 	    return 0;
 	}
+	_wire_wait_async();
+
 	// reset buffer pointer
 	wire.rx.index = 0;
 	wire.rx.length = quantity;
@@ -146,11 +172,42 @@ static size_t _wire_requestFrom(UCHAR address,UCHAR quantity, UCHAR sendStop)
 	i2c_start(1,false,sendStop);						// ch, write, cont
 	
 	// wait end of communication
-	HALT_Until_Event(HALT_I2C1_END,timeout);
+	HALT_Until_Event(HALT_I2C1_END,0);				// bounded by timeout of driver
 
 	return i2c_read_amount(1);
 }
 
+// write register address and read data by repeated start.
+// sequence is executed in interrupt and data is stored to rx directly.
+// return = error code same as endTransmission
+static uint8_t _wire_writeRead(uint8_t address, uint8_t *tx, size_t tx_len, uint8_t *rx, size_t rx_len)
+{
+	_wire_wait_async();
+
+	if(i2c_write_read(1,address,tx,(UINT16)tx_len,rx,(UINT16)rx_len) == false)
+	{
+		return I2C_RESULT_ERROR;
+	}
+
+	// wait end of communication
+	HALT_Until_Event(HALT_I2C1_END,0);				// bounded by timeout of driver
+
+	return (uint8_t)i2c_get_err_status(1);
+}
+
+// set bus clock(Hz). 400000 = fast mode, 100000 = standard mode
+static void _wire_setClock(uint32_t clock)
+{
+	i2c_set_clock(1,clock);
+}
+
+// set bus clock(Hz) for the device. clock = 0 removes the setting.
+// return = false : number of devices is over I2C_CLOCK_TABLE_SIZE
+static bool _wire_setDeviceClock(uint8_t address, uint32_t clock)
+{
+	return i2c_set_device_clock(1,address,clock);
+}
+
 // return number of byte in rx buffer
 static int _wire_available(void)
 {
@@ -168,15 +225,45 @@ static int _wire_read(void)
 	}
 	return value;
 }
+// sequence which is not completed in timeout returns I2C_RESULT_TIMEOUT(5),
+// and bus is recovered by next call of Wire or Wire.poll().
+// ms = 0 : wait forever
 static void _wire_setTimeout(uint16_t ms)
 {
-	timeout = ms;
+	i2c_set_timeout(1,ms);
 }
 static void _wire_end(void) {
 	i2c_close(1);
 	return;
 }
 
+// queue asynchronous transaction. CPU can run other process until callback.
+static BOOLEAN _wire_submit(I2C_XFER *xfer)
+{
+	return i2c_submit(1,xfer);
+}
+
+// return number of asynchronous transactions not completed
+// bus stopped by timeout is recovered here, and queued transactions are restarted.
+static uint8_t _wire_poll(void)
+{
+	i2c_poll(1);
+	return i2c_xfer_pending(1);
+}
+
+// return number of errors of the device (NACK, bus error and timeout)
+static uint16_t _wire_getErrorCount(uint8_t address)
+{
+	return i2c_get_error_count(1,address);
+}
+
+// release bus stuck by slave. must not be called during asynchronous transaction.
+// return = false : SDA is still low
+static bool _wire_recover(void)
+{
+	return i2c_bus_recover(1);
+}
+
 const TwoWire Wire ={
 	_wire_begin,
 	_wire_requestFrom,
@@ -187,6 +274,13 @@ const TwoWire Wire ={
 	_wire_write,
 	_wire_endTransmission,
 	_wire_setTimeout,
-	_wire_end
+	_wire_end,
+	_wire_submit,
+	_wire_poll,
+	_wire_writeRead,
+	_wire_setClock,
+	_wire_setDeviceClock,
+	_wire_getErrorCount,
+	_wire_recover
 };
 
@@ -23,6 +23,7 @@
 
 #include "common.h"
 #include "lazurite.h"
+#include "driver_i2c.h"
 
 #define I2C_BUFFER_LENGTH 32
 
@@ -48,6 +49,13 @@ typedef struct {
 	uint8_t (*endTransmission)(uint8_t sendStop);
 	void (*setTimeout)(uint16_t ms);
 	void (*end)(void);
+	BOOLEAN (*submit)(I2C_XFER *xfer);
+	uint8_t (*poll)(void);
+	uint8_t (*writeRead)(uint8_t address, uint8_t *tx, size_t tx_len, uint8_t *rx, size_t rx_len);
+	void (*setClock)(uint32_t clock);
+	bool (*setDeviceClock)(uint8_t address, uint32_t clock);
+	uint16_t (*getErrorCount)(uint8_t address);
+	bool (*recover)(void);
 }TwoWire;
 
 extern const TwoWire Wire;
@@ -40,22 +40,10 @@ byte kx022_write(unsigned char memory_address, unsigned char *data, uint8_t size
 byte kx022_read(unsigned char memory_address, unsigned char *data, uint8_t size)
 {
   byte rc;
-  unsigned char cnt;
 
-  Wire.beginTransmission(_device_address);
-  Wire.write_byte(memory_address);
-  rc = Wire.endTransmission(false);
-  if (rc != 0) {
-    return (rc);
-  }
-  Wire.requestFrom(_device_address, size, true);
-  cnt = 0;
-  while(Wire.available()) {
-  	data[cnt] = (uint8_t)Wire.read();
-    cnt++;
-  }
+  rc = Wire.writeRead(_device_address, &memory_address, 1, data, size);
 
-  return (0);
+  return (rc);
 }
 
 
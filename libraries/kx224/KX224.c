@@ -41,23 +41,10 @@ static uint8_t KX224_write(unsigned char memory_address, unsigned char *data, un
 uint8_t KX224_read(unsigned char memory_address, unsigned char *data, int size)
 {
   byte rc;
-  unsigned char cnt;
 
-  Wire.beginTransmission(_device_address);
-  Wire.write_byte(memory_address);
-  rc = Wire.endTransmission(false);
-  if (rc != 0) {
-    return (rc);
-  }
-
-  Wire.requestFrom(_device_address, size, true);
-  cnt = 0;
-  while(Wire.available()) {
-    data[cnt] = Wire.read();
-    cnt++;
-  }
+  rc = Wire.writeRead(_device_address, &memory_address, 1, data, size);
 
-  return (0);
+  return (rc);
 }
 
 uint8_t KX224_init(int slave_address)
@@ -40,19 +40,8 @@ static byte kxg03_write(unsigned char memory_address, unsigned char *data, unsig
 static byte kxg03_read(unsigned char memory_address, unsigned char *data, int size)
 {
   byte rc;
-  unsigned char cnt;
-  Wire.beginTransmission(device_address);
-  Wire.write_byte(memory_address);
-  rc = Wire.endTransmission(false);
-  if (rc != 0) {
-    return (rc);
-  }
-  Wire.requestFrom(device_address, size, true);
-  cnt = 0;
-  while(Wire.available()) {
-    data[cnt] = Wire.read();
-    cnt++;
-  }
+
+  rc = Wire.writeRead(device_address, &memory_address, 1, data, size);
 
   return (rc);
 }
@@ -122,26 +122,12 @@ static float kalman_cal(KALMAN_PARAM *param,float newAngle, float newRate){
 static uint8_t kxg03_read(uint8_t addr,uint8_t* data,uint8_t size)
 {
 	byte rc;
-	unsigned char cnt;
 	
-	Wire.beginTransmission(slave_addr);
-	Wire.write_byte(addr);
-	rc = Wire.endTransmission(false);
+	rc = Wire.writeRead(slave_addr, &addr, 1, data, size);
 	if (rc != 0) {
-//		Serial.print("read.endTransmission=0x");
-//		Serial.print_long((long)addr,HEX);
-//		Serial.print(",");
-//		Serial.println_long((long)rc,HEX);
-//		return (rc);
+		return 0;
 	}
-	rc=Wire.requestFrom(slave_addr, size, true);
-	cnt = 0;
-	while(Wire.available())
-	{
-		data[cnt] = (uint8_t)Wire.read();
-		cnt++;
-	}
-	return (rc);
+	return (size);
 }
 
 static uint8_t kxg03_write(uint8_t addr,uint8_t* data, uint8_t size)